@@ -0,0 +1,573 @@
+#ifndef UNUMBER_AGGREGATE_H
+#define UNUMBER_AGGREGATE_H
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <functional>
+#include <ranges>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "Numeric.h"
+#include "NumericColumn.h"
+
+namespace usub::umath {
+    // Execution policies for the range reductions below. They mirror std::execution's names without including
+    // <execution>, which in libstdc++ pulls in TBB. par uses every hardware thread and par(n) at most n; a
+    // result never depends on the policy or the thread count.
+    namespace execution {
+        struct sequenced_policy {
+        };
+
+        struct parallel_policy {
+            unsigned threads = 0;
+
+            constexpr parallel_policy operator()(unsigned n) const noexcept { return {n}; }
+        };
+
+        struct parallel_unsequenced_policy : parallel_policy {
+            constexpr parallel_unsequenced_policy operator()(unsigned n) const noexcept { return {{n}}; }
+        };
+
+        inline constexpr sequenced_policy seq{};
+        inline constexpr parallel_policy par{};
+        inline constexpr parallel_unsequenced_policy par_unseq{};
+    } // namespace execution
+
+    namespace detail {
+        template<class T>
+        struct is_numeric128 : std::false_type {
+        };
+
+        template<int P, int S>
+        struct is_numeric128<Numeric128<P, S>> : std::true_type {
+        };
+
+        template<class R>
+        concept numeric128_range = std::ranges::contiguous_range<R> &&
+                                   is_numeric128<std::remove_cv_t<std::ranges::range_value_t<R>>>::value;
+
+        // A contiguous range of Numeric128 or Numeric256 values.
+        template<class R>
+        concept decimal_range = std::ranges::contiguous_range<R> &&
+                                is_fixed_decimal<std::remove_cv_t<std::ranges::range_value_t<R>>>::value;
+
+        template<class R>
+        using range_elem_t = std::remove_cv_t<std::ranges::range_value_t<R>>;
+
+        template<class R>
+        std::span<const range_elem_t<R>> elem_span(const R &xs) noexcept {
+            return {std::ranges::data(xs), std::ranges::size(xs)};
+        }
+
+        template<class R>
+        concept numeric_range = std::ranges::contiguous_range<R> && std::same_as<range_elem_t<R>, Numeric>;
+
+        template<class T>
+        concept execution_policy = std::same_as<T, execution::sequenced_policy> ||
+                                   std::derived_from<T, execution::parallel_policy>;
+
+        // 192-bit running sum of int128 values: a wrapping 128-bit low part plus a signed carry count.
+        // No overflow checks are needed below 2^63 additions.
+        struct wide_sum {
+            uint128 lo{};
+            std::int64_t hi = 0;
+
+            void add(const int128 &r) noexcept {
+                const uint128 u{static_cast<std::uint64_t>(r.high()), r.low()};
+                lo += u;
+                hi += static_cast<std::int64_t>(lo < u) - static_cast<std::int64_t>(r.high() < 0);
+            }
+
+            void merge(const wide_sum &o) noexcept {
+                lo += o.lo;
+                hi += static_cast<std::int64_t>(lo < o.lo) + o.hi;
+            }
+
+            [[nodiscard]] int256 value() const noexcept {
+                return int256(hi < 0 ? -1 : 0, static_cast<std::uint64_t>(hi), lo.high(), lo.low());
+            }
+        };
+
+        // Sums raw values with two independent accumulators; err is the first error seen (or None).
+        template<int P, int S>
+        wide_sum sum_raw(std::span<const Numeric128<P, S>> xs, Err &err) noexcept {
+            wide_sum s0, s1;
+            unsigned any_err = 0;
+            std::size_t i = 0;
+            for (; i + 2 <= xs.size(); i += 2) {
+                s0.add(xs[i].raw());
+                s1.add(xs[i + 1].raw());
+                any_err |= static_cast<unsigned>(xs[i].error()) | static_cast<unsigned>(xs[i + 1].error());
+            }
+            if (i < xs.size()) {
+                s0.add(xs[i].raw());
+                any_err |= static_cast<unsigned>(xs[i].error());
+            }
+            s0.merge(s1);
+
+            err = Err::None;
+            if (any_err != 0) {
+                for (const auto &x: xs) {
+                    if (!x.ok()) {
+                        err = x.error();
+                        break;
+                    }
+                }
+            }
+            return s0;
+        }
+
+        template<int P, int S>
+        wide_sum sum_raw(const Numeric128Column<P, S> &col, Err &err) noexcept {
+            wide_sum s0, s1;
+            const auto raw = col.raw_data();
+            std::size_t i = 0;
+            for (; i + 2 <= raw.size(); i += 2) {
+                s0.add(raw[i]);
+                s1.add(raw[i + 1]);
+            }
+            if (i < raw.size()) s0.add(raw[i]);
+            s0.merge(s1);
+
+            err = Err::None;
+            for (std::uint64_t w: col.status_data()) {
+                if (w != 0) {
+                    err = static_cast<Err>((w >> (std::countr_zero(w) & ~1)) & 3U);
+                    break;
+                }
+            }
+            return s0;
+        }
+
+        // Fewest pairs per worker before dot() splits its input.
+        inline constexpr std::size_t dot_min_chunk = 1U << 14;
+
+        // Fewest elements per worker before a reduction under a parallel policy splits its input.
+        inline constexpr std::size_t reduce_min_chunk = 1U << 14;
+
+        template<class Policy>
+        std::size_t policy_chunks(const Policy &policy, std::size_t n, std::size_t min_chunk) noexcept {
+            if constexpr (std::same_as<Policy, execution::sequenced_policy>) {
+                return 1;
+            } else {
+                const unsigned t = policy.threads != 0 ? policy.threads : std::thread::hardware_concurrency();
+                return std::clamp<std::size_t>(t, 1, n / min_chunk + 1);
+            }
+        }
+
+        // total / n rounded per rnd; the quotient of a mean always fits the element type.
+        inline int128 mean_raw(const int256 &total, std::size_t n, Rounding rnd) noexcept {
+            const bool neg = total.is_negative();
+            const uint256 den{static_cast<std::uint64_t>(n)};
+            uint256 rem{};
+            uint256 q = div_u256(abs_u256(total), den, rem);
+            if (rnd == Rounding::HalfUp && rem + rem >= den) q += uint256{1U};
+            const uint128 mag = q.low();
+            return apply_sign(mag, neg);
+        }
+
+        // 320-bit running sum of int256 products, in the same wrapping-low-part-plus-carry form as wide_sum.
+        struct wide_dot {
+            uint256 lo{};
+            std::int64_t hi = 0;
+
+            void add(const int256 &p) noexcept {
+                const uint256 u(p.high(), p.low());
+                lo += u;
+                hi += static_cast<std::int64_t>(lo < u) - static_cast<std::int64_t>(p.is_negative());
+            }
+
+            void merge(const wide_dot &o) noexcept {
+                lo += o.lo;
+                hi += static_cast<std::int64_t>(lo < o.lo) + o.hi;
+            }
+
+            // The total divided by 10^k and rounded per rnd; false if that does not fit P digits.
+            template<int P>
+            bool scale_down(unsigned k, Rounding rnd, int256 &out) const noexcept {
+                const bool neg = hi < 0;
+                std::uint64_t w[5] = {lo.low().low(), lo.low().high(), lo.high().low(), lo.high().high(),
+                                      static_cast<std::uint64_t>(hi)};
+                if (neg) {
+                    unsigned carry = 1;
+                    for (std::uint64_t &x: w) {
+                        x = ~x + carry;
+                        carry = carry && x == 0;
+                    }
+                }
+
+                uint256 rem{0U};
+                uint256 weight{1U};
+                for (unsigned left = k; left > 0;) {
+                    const auto step = static_cast<unsigned>(std::min<std::size_t>(left, pow10_divisor_max));
+                    rem += uint256{divrem_pow10_limbs(w, step)} * weight;
+                    weight *= uint256{pow10_divisors[step].value};
+                    left -= step;
+                }
+                if (w[4] != 0) return false;
+
+                uint256 q{uint128{w[3], w[2]}, uint128{w[1], w[0]}};
+                if (rnd == Rounding::HalfUp && k > 0 && rem + rem >= weight) q += uint256{1U};
+                if (!(q < precision_bound_u256<P>)) return false;
+                out = apply_sign_u256(q, neg);
+                return true;
+            }
+        };
+
+        template<int P, int S>
+        wide_dot sum_raw(std::span<const Numeric256<P, S>> xs, Err &err) noexcept {
+            wide_dot s0, s1;
+            unsigned any_err = 0;
+            std::size_t i = 0;
+            for (; i + 2 <= xs.size(); i += 2) {
+                s0.add(xs[i].raw());
+                s1.add(xs[i + 1].raw());
+                any_err |= static_cast<unsigned>(xs[i].error()) | static_cast<unsigned>(xs[i + 1].error());
+            }
+            if (i < xs.size()) {
+                s0.add(xs[i].raw());
+                any_err |= static_cast<unsigned>(xs[i].error());
+            }
+            s0.merge(s1);
+
+            err = Err::None;
+            if (any_err != 0) {
+                for (const auto &x: xs) {
+                    if (!x.ok()) {
+                        err = x.error();
+                        break;
+                    }
+                }
+            }
+            return s0;
+        }
+
+        // Runs part(lo, hi, err) over `chunks` contiguous slices of [0, n) on as many threads and merges the
+        // partial accumulators in slice order; err is the first error in input order.
+        template<class Part>
+        auto reduce_chunks(std::size_t n, std::size_t chunks, Err &err, Part part) {
+            if (chunks <= 1) return part(0, n, err);
+
+            using acc_t = decltype(part(0, n, err));
+            std::vector<acc_t> parts(chunks);
+            std::vector<Err> errs(chunks, Err::None);
+            parallel_for(chunks, static_cast<unsigned>(chunks), [&](std::size_t c) {
+                parts[c] = part(n * c / chunks, n * (c + 1) / chunks, errs[c]);
+            });
+
+            err = errs[0];
+            for (std::size_t c = 1; c < chunks; ++c) {
+                parts[0].merge(parts[c]);
+                if (err == Err::None) err = errs[c];
+            }
+            return parts[0];
+        }
+
+        template<int S>
+        Numeric256<76, S> wide_total(const wide_sum &s, Err err) noexcept {
+            return numeric_access::make<Numeric256<76, S>>(s.value(), err);
+        }
+
+        template<int S>
+        Numeric256<76, S> wide_total(const wide_dot &s, Err err) noexcept {
+            using R = Numeric256<76, S>;
+            if (err != Err::None) return numeric_access::make<R>(int256{0}, err);
+            int256 out{};
+            if (!s.scale_down<76>(0, Rounding::Trunc, out)) return numeric_access::make<R>(int256{0}, Err::Overflow);
+            return numeric_access::make<R>(out, Err::None);
+        }
+
+        // Position of the smallest (or, with Max, largest) value, the earliest one on ties, as a running
+        // merge-able state: merging keeps the ordering of the slices.
+        template<class T, bool Max>
+        struct extreme {
+            const T *at = nullptr;
+
+            void add(const T &x) noexcept {
+                if (at == nullptr || (Max ? at->raw() < x.raw() : x.raw() < at->raw())) at = &x;
+            }
+
+            void merge(const extreme &o) noexcept {
+                if (o.at != nullptr) add(*o.at);
+            }
+        };
+
+        template<bool Max, class T>
+        extreme<T, Max> extreme_raw(std::span<const T> xs, Err &err) noexcept {
+            extreme<T, Max> r;
+            err = Err::None;
+            for (const T &x: xs) {
+                if (x.ok()) r.add(x);
+                else if (err == Err::None) err = x.error();
+            }
+            return r;
+        }
+
+        template<class T>
+        auto sum_policy_impl(std::span<const T> xs, std::size_t chunks) {
+            Err err = Err::None;
+            const auto total = reduce_chunks(xs.size(), chunks, err, [xs](std::size_t lo, std::size_t hi, Err &er) {
+                return sum_raw(xs.subspan(lo, hi - lo), er);
+            });
+            return wide_total<T::scale>(total, err);
+        }
+
+        inline Numeric numeric_sum_impl(std::span<const Numeric> xs, std::size_t chunks) {
+            Err err = Err::None;
+            const NumericAccumulator acc = reduce_chunks(xs.size(), chunks, err,
+                                                         [xs](std::size_t lo, std::size_t hi, Err &er) {
+                                                             NumericAccumulator a;
+                                                             for (std::size_t i = lo; i < hi; ++i) a.add(xs[i]);
+                                                             er = a.error();
+                                                             return a;
+                                                         });
+            return acc.result();
+        }
+
+        template<bool Max, class T>
+        T extreme_impl(std::span<const T> xs, std::size_t chunks) {
+            using raw_t = decltype(std::declval<const T &>().raw());
+            Err err = Err::None;
+            const auto e = reduce_chunks(xs.size(), chunks, err, [xs](std::size_t lo, std::size_t hi, Err &er) {
+                return extreme_raw<Max>(xs.subspan(lo, hi - lo), er);
+            });
+            if (err != Err::None) return numeric_access::make<T>(raw_t{0}, err);
+            if (e.at == nullptr) return numeric_access::make<T>(raw_t{0}, Err::Invalid);
+            return *e.at;
+        }
+
+        // Sums f(x) over xs exactly; f returns a Numeric128 or Numeric256.
+        template<class T, class F>
+        wide_dot transform_raw(std::span<const T> xs, const F &f, Err &err) {
+            wide_dot acc;
+            err = Err::None;
+            for (const T &x: xs) {
+                const auto y = std::invoke(f, x);
+                if (y.ok()) acc.add(wide_raw(y));
+                else if (err == Err::None) err = y.error();
+            }
+            return acc;
+        }
+
+        template<class T, class F>
+        auto transform_sum_impl(std::span<const T> xs, std::size_t chunks, const F &f) {
+            using Y = std::remove_cvref_t<std::invoke_result_t<const F &, const T &>>;
+            Err err = Err::None;
+            const wide_dot total = reduce_chunks(xs.size(), chunks, err,
+                                                 [xs, &f](std::size_t lo, std::size_t hi, Err &er) {
+                                                     return transform_raw(xs.subspan(lo, hi - lo), f, er);
+                                                 });
+            return wide_total<Y::scale>(total, err);
+        }
+
+        // Sums a[i] * b[i] with two independent accumulators; any_err collects the inputs' error bits.
+        template<int P, int S>
+        wide_dot dot_raw(const Numeric128<P, S> *a, const Numeric128<P, S> *b, std::size_t n,
+                         unsigned &any_err) noexcept {
+            wide_dot s0, s1;
+            unsigned e = 0;
+            std::size_t i = 0;
+            for (; i + 2 <= n; i += 2) {
+                s0.add(widen_i256(a[i].raw()) * widen_i256(b[i].raw()));
+                s1.add(widen_i256(a[i + 1].raw()) * widen_i256(b[i + 1].raw()));
+                e |= static_cast<unsigned>(a[i].error()) | static_cast<unsigned>(b[i].error()) |
+                     static_cast<unsigned>(a[i + 1].error()) | static_cast<unsigned>(b[i + 1].error());
+            }
+            if (i < n) {
+                s0.add(widen_i256(a[i].raw()) * widen_i256(b[i].raw()));
+                e |= static_cast<unsigned>(a[i].error()) | static_cast<unsigned>(b[i].error());
+            }
+            s0.merge(s1);
+            any_err = e;
+            return s0;
+        }
+
+        template<int P, int S>
+        Numeric256<76, S> dot_impl(std::span<const Numeric128<P, S>> a, std::span<const Numeric128<P, S>> b,
+                                   Rounding rnd, std::size_t chunks) {
+            using R = Numeric256<76, S>;
+            const std::size_t n = std::min(a.size(), b.size());
+
+            wide_dot total;
+            unsigned any_err = 0;
+            chunks = std::clamp<std::size_t>(chunks, 1, n / dot_min_chunk + 1);
+            if (chunks == 1) {
+                total = dot_raw(a.data(), b.data(), n, any_err);
+            } else {
+                std::vector<wide_dot> parts(chunks);
+                std::vector<unsigned> errs(chunks);
+                parallel_for(chunks, static_cast<unsigned>(chunks), [&](std::size_t c) {
+                    const std::size_t lo = n * c / chunks, hi = n * (c + 1) / chunks;
+                    parts[c] = dot_raw(a.data() + lo, b.data() + lo, hi - lo, errs[c]);
+                });
+                for (std::size_t c = 0; c < chunks; ++c) {
+                    total.merge(parts[c]);
+                    any_err |= errs[c];
+                }
+            }
+
+            if (any_err != 0) {
+                for (std::size_t i = 0; i < n; ++i) {
+                    if (!a[i].ok()) return numeric_access::make<R>(int256{0}, a[i].error());
+                    if (!b[i].ok()) return numeric_access::make<R>(int256{0}, b[i].error());
+                }
+            }
+
+            int256 out{};
+            if (!total.scale_down<76>(static_cast<unsigned>(S), rnd, out)) {
+                return numeric_access::make<R>(int256{0}, Err::Overflow);
+            }
+            return numeric_access::make<R>(out, Err::None);
+        }
+
+        template<int P, int S, class Src>
+        Numeric256<76, S> sum_impl(const Src &src) noexcept {
+            Err err;
+            const wide_sum s = sum_raw(src, err);
+            return numeric_access::make<Numeric256<76, S>>(s.value(), err);
+        }
+
+        template<int P, int S, class Src>
+        std::expected<Numeric128<P, S>, Err> sum_checked_impl(const Src &src) noexcept {
+            Err err;
+            const int256 total = sum_raw(src, err).value();
+            if (err != Err::None) return std::unexpected(err);
+            if (!fits_precision_i256<P>(total)) return std::unexpected(Err::Overflow);
+            const uint256 mag = abs_u256(total);
+            return numeric_access::make<Numeric128<P, S>>(apply_sign(mag.low(), total.is_negative()), Err::None);
+        }
+
+        template<int P, int S, class Src>
+        Numeric128<P, S> avg_impl(const Src &src, std::size_t n, Rounding rnd) noexcept {
+            using N = Numeric128<P, S>;
+            if (n == 0) return numeric_access::make<N>(int128{0}, Err::DivByZero);
+            Err err;
+            const int256 total = sum_raw(src, err).value();
+            if (err != Err::None) return numeric_access::make<N>(int128{0}, err);
+            return numeric_access::make<N>(mean_raw(total, n, rnd), Err::None);
+        }
+    } // namespace detail
+
+    // SUM over Numeric128<P,S> values without per-element overflow checks. The result is exact: the
+    // running total is kept in 192 bits and returned as Numeric256<76,S>. An input error is propagated.
+    template<detail::numeric128_range R>
+    auto sum(const R &xs) noexcept {
+        using N = std::remove_cv_t<std::ranges::range_value_t<R>>;
+        return detail::sum_impl<N::precision, N::scale>(std::span<const N>(std::ranges::data(xs), std::ranges::size(xs)));
+    }
+
+    template<int P, int S>
+    Numeric256<76, S> sum(const Numeric128Column<P, S> &col) noexcept {
+        return detail::sum_impl<P, S>(col);
+    }
+
+    // SUM narrowed back to Numeric128<P,S>; Overflow only if the final total needs more than P digits.
+    template<detail::numeric128_range R>
+    auto sum_checked(const R &xs) noexcept {
+        using N = std::remove_cv_t<std::ranges::range_value_t<R>>;
+        return detail::sum_checked_impl<N::precision, N::scale>(
+            std::span<const N>(std::ranges::data(xs), std::ranges::size(xs)));
+    }
+
+    template<int P, int S>
+    std::expected<Numeric128<P, S>, Err> sum_checked(const Numeric128Column<P, S> &col) noexcept {
+        return detail::sum_checked_impl<P, S>(col);
+    }
+
+    // AVG in the input type, rounded once from the exact total. An empty input yields DivByZero.
+    template<detail::numeric128_range R>
+    auto avg(const R &xs, Rounding rnd = Rounding::HalfUp) noexcept {
+        using N = std::remove_cv_t<std::ranges::range_value_t<R>>;
+        return detail::avg_impl<N::precision, N::scale>(
+            std::span<const N>(std::ranges::data(xs), std::ranges::size(xs)), std::ranges::size(xs), rnd);
+    }
+
+    template<int P, int S>
+    Numeric128<P, S> avg(const Numeric128Column<P, S> &col, Rounding rnd = Rounding::HalfUp) noexcept {
+        return detail::avg_impl<P, S>(col, col.size(), rnd);
+    }
+
+    // Dot product sum(a[i] * b[i]) over the first min(a.size(), b.size()) pairs. Products are summed unscaled
+    // in 320 bits and the total is divided by 10^S and rounded once, returned as Numeric256<76,S>. With
+    // chunks > 1 large inputs are split into that many slices run on the shared thread pool; the result does not
+    // depend on chunks.
+    template<detail::numeric128_range A, detail::numeric128_range B>
+        requires std::same_as<std::remove_cv_t<std::ranges::range_value_t<A>>,
+                              std::remove_cv_t<std::ranges::range_value_t<B>>>
+    auto dot(const A &a, const B &b, Rounding rnd = Rounding::HalfUp, std::size_t chunks = 1) {
+        using N = std::remove_cv_t<std::ranges::range_value_t<A>>;
+        return detail::dot_impl<N::precision, N::scale>(std::span<const N>(std::ranges::data(a), std::ranges::size(a)),
+                                                        std::span<const N>(std::ranges::data(b), std::ranges::size(b)),
+                                                        rnd, chunks);
+    }
+
+    // Reductions under an execution policy over Numeric128 or Numeric256 ranges. Parallel policies split the
+    // input into contiguous slices with exact partial accumulators that are merged in slice order, so results
+    // are identical for every policy and thread count. sum (and reduce, its std-style spelling) returns the
+    // exact total as Numeric256<76,S>; a Numeric256 total beyond 76 digits is Overflow. The first input
+    // error in range order is propagated.
+    template<detail::execution_policy Policy, detail::decimal_range R>
+    auto sum(const Policy &policy, const R &xs) {
+        const auto v = detail::elem_span(xs);
+        return detail::sum_policy_impl(v, detail::policy_chunks(policy, v.size(), detail::reduce_min_chunk));
+    }
+
+    // Exact sum of Numeric values through per-slice NumericAccumulators; the scale is the largest input scale.
+    template<detail::execution_policy Policy, detail::numeric_range R>
+    Numeric sum(const Policy &policy, const R &xs) {
+        const auto v = detail::elem_span(xs);
+        return detail::numeric_sum_impl(v, detail::policy_chunks(policy, v.size(), detail::reduce_min_chunk));
+    }
+
+    template<detail::numeric_range R>
+    Numeric sum(const R &xs) { return sum(execution::seq, xs); }
+
+    template<detail::execution_policy Policy, class R>
+        requires detail::decimal_range<R> || detail::numeric_range<R>
+    auto reduce(const Policy &policy, const R &xs) {
+        return sum(policy, xs);
+    }
+
+    // Exact sum of f(x); f maps an element to a Numeric128 or Numeric256 and may be called concurrently.
+    template<detail::execution_policy Policy, detail::decimal_range R, class F>
+        requires detail::is_fixed_decimal<
+            std::remove_cvref_t<std::invoke_result_t<const F &, const detail::range_elem_t<R> &>>>::value
+    auto transform_reduce(const Policy &policy, const R &xs, F f) {
+        const auto v = detail::elem_span(xs);
+        return detail::transform_sum_impl(v, detail::policy_chunks(policy, v.size(), detail::reduce_min_chunk), f);
+    }
+
+    // sum(a[i] * b[i]), as dot() with the policy choosing the number of chunks.
+    template<detail::execution_policy Policy, detail::numeric128_range A, detail::numeric128_range B>
+        requires std::same_as<detail::range_elem_t<A>, detail::range_elem_t<B>>
+    auto transform_reduce(const Policy &policy, const A &a, const B &b, Rounding rnd = Rounding::HalfUp) {
+        const std::size_t n = std::min(std::ranges::size(a), std::ranges::size(b));
+        return dot(a, b, rnd, detail::policy_chunks(policy, n, detail::dot_min_chunk));
+    }
+
+    // MIN/MAX in the element type; the first error wins and an empty input is Invalid.
+    template<detail::execution_policy Policy, detail::decimal_range R>
+    auto min(const Policy &policy, const R &xs) {
+        const auto v = detail::elem_span(xs);
+        return detail::extreme_impl<false>(v, detail::policy_chunks(policy, v.size(), detail::reduce_min_chunk));
+    }
+
+    template<detail::execution_policy Policy, detail::decimal_range R>
+    auto max(const Policy &policy, const R &xs) {
+        const auto v = detail::elem_span(xs);
+        return detail::extreme_impl<true>(v, detail::policy_chunks(policy, v.size(), detail::reduce_min_chunk));
+    }
+
+    template<detail::decimal_range R>
+    auto min(const R &xs) { return min(execution::seq, xs); }
+
+    template<detail::decimal_range R>
+    auto max(const R &xs) { return max(execution::seq, xs); }
+} // namespace usub::umath
+
+#endif // UNUMBER_AGGREGATE_H
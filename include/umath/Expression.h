@@ -0,0 +1,170 @@
+#ifndef UNUMBER_EXPRESSION_H
+#define UNUMBER_EXPRESSION_H
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+#include "Numeric.h"
+
+namespace usub::umath {
+    namespace detail {
+        inline constexpr long double expr_acc_bound = 5.7e76L; // just below 2^255
+
+        constexpr long double pow10_bound(int k) noexcept {
+            long double v = 1.0L;
+            for (int i = 0; i < k; ++i) v *= 10.0L;
+            return v;
+        }
+
+        // Expression nodes carry the exact value's scale and an upper bound on its magnitude (in units of
+        // 10^-scale) at compile time; eval() returns the exact raw value and records the first input error.
+        template<int P, int S>
+        struct expr_leaf {
+            static constexpr int scale = S;
+            static constexpr long double bound = pow10_bound(P);
+
+            Numeric128<P, S> v;
+
+            int256 eval(Err &err) const noexcept {
+                if (!v.ok() && err == Err::None) err = v.error();
+                return widen_i256(v.raw());
+            }
+        };
+
+        template<class L, class R>
+        struct expr_mul {
+            static constexpr int scale = L::scale + R::scale;
+            static constexpr long double bound = L::bound * R::bound;
+
+            L l;
+            R r;
+
+            // Operands are evaluated left to right, so the first input error is the leftmost one.
+            int256 eval(Err &err) const noexcept {
+                const int256 a = l.eval(err);
+                const int256 b = r.eval(err);
+                return a * b;
+            }
+        };
+
+        template<class L, class R, bool Sub>
+        struct expr_add {
+            static constexpr int scale = std::max(L::scale, R::scale);
+            static constexpr long double bound = L::bound * pow10_bound(scale - L::scale) +
+                                                 R::bound * pow10_bound(scale - R::scale);
+
+            L l;
+            R r;
+
+            int256 eval(Err &err) const noexcept {
+                int256 a = l.eval(err);
+                int256 b = r.eval(err);
+                if constexpr (L::scale < scale) a = a * int256(pow10_u256(static_cast<unsigned>(scale - L::scale)));
+                if constexpr (R::scale < scale) b = b * int256(pow10_u256(static_cast<unsigned>(scale - R::scale)));
+                if constexpr (Sub) return a - b;
+                else return a + b;
+            }
+        };
+    } // namespace detail
+
+    // A deferred Numeric128 expression of +, - and *. The whole expression is evaluated exactly in a 256-bit
+    // accumulator and rounded once into the target type, so `expr(price) * qty + fee` performs one precision
+    // check and one division by a power of ten. Operands are captured by value. Expressions whose
+    // intermediate magnitude could exceed 256 bits are rejected at compile time.
+    template<class E>
+    class Expr {
+    public:
+        static constexpr int scale = E::scale;
+
+        constexpr explicit Expr(E e) noexcept : e_(e) {
+        }
+
+        template<int P, int S>
+        [[nodiscard]] Numeric128<P, S> eval(Rounding rnd = Rounding::HalfUp) const noexcept {
+            static_assert(E::bound * detail::pow10_bound(std::max(0, S - E::scale)) < detail::expr_acc_bound,
+                          "expression may overflow the 256-bit accumulator");
+            using N = Numeric128<P, S>;
+
+            Err err = Err::None;
+            const int256 v = e_.eval(err);
+            if (err != Err::None) return detail::numeric_access::make<N>(int128{0}, err);
+            return detail::narrow_scaled<N, E::scale>(v, rnd);
+        }
+
+        template<int P, int S>
+        operator Numeric128<P, S>() const noexcept { return eval<P, S>(); }
+
+        [[nodiscard]] const E &node() const noexcept { return e_; }
+
+    private:
+        E e_;
+    };
+
+    template<int P, int S>
+    constexpr Expr<detail::expr_leaf<P, S>> expr(const Numeric128<P, S> &v) noexcept {
+        return Expr<detail::expr_leaf<P, S>>({v});
+    }
+
+    namespace detail {
+        template<class T>
+        struct expr_node;
+
+        template<class E>
+        struct expr_node<Expr<E>> {
+            using type = E;
+            static constexpr const E &get(const Expr<E> &x) noexcept { return x.node(); }
+        };
+
+        template<int P, int S>
+        struct expr_node<Numeric128<P, S>> {
+            using type = expr_leaf<P, S>;
+            static constexpr type get(const Numeric128<P, S> &x) noexcept { return {x}; }
+        };
+
+        template<class T>
+        struct is_expr : std::false_type {
+        };
+
+        template<class E>
+        struct is_expr<Expr<E>> : std::true_type {
+        };
+
+        template<class T>
+        concept expr_operand = requires { typename expr_node<std::remove_cvref_t<T>>::type; };
+
+        // At least one side must already be an Expr so plain Numeric128 arithmetic is untouched.
+        template<class A, class B>
+        concept expr_pair = expr_operand<A> && expr_operand<B> &&
+                            (is_expr<std::remove_cvref_t<A>>::value || is_expr<std::remove_cvref_t<B>>::value);
+
+        template<class A>
+        using node_t = typename expr_node<std::remove_cvref_t<A>>::type;
+
+        template<class A>
+        constexpr node_t<A> node_of(const A &a) noexcept { return expr_node<std::remove_cvref_t<A>>::get(a); }
+    } // namespace detail
+
+    template<class A, class B>
+        requires detail::expr_pair<A, B>
+    constexpr auto operator*(const A &a, const B &b) noexcept {
+        using N = detail::expr_mul<detail::node_t<A>, detail::node_t<B>>;
+        return Expr<N>(N{detail::node_of(a), detail::node_of(b)});
+    }
+
+    template<class A, class B>
+        requires detail::expr_pair<A, B>
+    constexpr auto operator+(const A &a, const B &b) noexcept {
+        using N = detail::expr_add<detail::node_t<A>, detail::node_t<B>, false>;
+        return Expr<N>(N{detail::node_of(a), detail::node_of(b)});
+    }
+
+    template<class A, class B>
+        requires detail::expr_pair<A, B>
+    constexpr auto operator-(const A &a, const B &b) noexcept {
+        using N = detail::expr_add<detail::node_t<A>, detail::node_t<B>, true>;
+        return Expr<N>(N{detail::node_of(a), detail::node_of(b)});
+    }
+} // namespace usub::umath
+
+#endif // UNUMBER_EXPRESSION_H
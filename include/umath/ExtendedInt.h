@@ -2,16 +2,133 @@
 #define UNUMBER_INT128_H
 
 #include <bit>
+#include <charconv>
 #include <cstdint>
+#include <cstring>
 #include <compare>
 #include <limits>
 #include <ostream>
 #include <string>
 #include <utility>
 #include <algorithm>
+#include <system_error>
 #include <type_traits>
 
 namespace usub::umath {
+    namespace detail {
+        inline constexpr char digit_pairs[] =
+                "00010203040506070809"
+                "10111213141516171819"
+                "20212223242526272829"
+                "30313233343536373839"
+                "40414243444546474849"
+                "50515253545556575859"
+                "60616263646566676869"
+                "70717273747576777879"
+                "80818283848586878889"
+                "90919293949596979899";
+
+        inline constexpr std::uint64_t pow10_19 = 10'000'000'000'000'000'000ULL;
+
+        inline std::uint64_t div_128_64(std::uint64_t hi, std::uint64_t lo,
+                                        std::uint64_t d, std::uint64_t &rem) noexcept {
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+            std::uint64_t q;
+            __asm__("divq %4" : "=a"(q), "=d"(rem) : "a"(lo), "d"(hi), "rm"(d));
+            return q;
+#elif defined(__SIZEOF_INT128__)
+            const unsigned __int128 num = (static_cast<unsigned __int128>(hi) << 64) | lo;
+            rem = static_cast<std::uint64_t>(num % d);
+            return static_cast<std::uint64_t>(num / d);
+#else
+            constexpr std::uint64_t b = std::uint64_t{1} << 32;
+            const int s = std::countl_zero(d);
+            d <<= s;
+            const std::uint64_t vn1 = d >> 32;
+            const std::uint64_t vn0 = d & 0xffffffffu;
+            const std::uint64_t un32 = (s == 0) ? hi : (hi << s) | (lo >> (64 - s));
+            const std::uint64_t un10 = lo << s;
+            const std::uint64_t un1 = un10 >> 32;
+            const std::uint64_t un0 = un10 & 0xffffffffu;
+
+            std::uint64_t q1 = un32 / vn1;
+            std::uint64_t rhat = un32 - q1 * vn1;
+            while (q1 >= b || q1 * vn0 > b * rhat + un1) {
+                --q1;
+                rhat += vn1;
+                if (rhat >= b) break;
+            }
+
+            const std::uint64_t un21 = un32 * b + un1 - q1 * d;
+            std::uint64_t q0 = un21 / vn1;
+            rhat = un21 - q0 * vn1;
+            while (q0 >= b || q0 * vn0 > b * rhat + un0) {
+                --q0;
+                rhat += vn1;
+                if (rhat >= b) break;
+            }
+
+            rem = (un21 * b + un0 - q0 * d) >> s;
+            return q1 * b + q0;
+#endif
+        }
+
+        inline char *write_u64_backward(char *last, std::uint64_t v) noexcept {
+            while (v >= 100) {
+                const std::size_t i = static_cast<std::size_t>(v % 100) * 2;
+                v /= 100;
+                *--last = digit_pairs[i + 1];
+                *--last = digit_pairs[i];
+            }
+            if (v >= 10) {
+                const std::size_t i = static_cast<std::size_t>(v) * 2;
+                *--last = digit_pairs[i + 1];
+                *--last = digit_pairs[i];
+            } else {
+                *--last = static_cast<char>('0' + v);
+            }
+            return last;
+        }
+
+        inline char *write_u64_padded19_backward(char *last, std::uint64_t v) noexcept {
+            for (int k = 0; k < 9; ++k) {
+                const std::size_t i = static_cast<std::size_t>(v % 100) * 2;
+                v /= 100;
+                *--last = digit_pairs[i + 1];
+                *--last = digit_pairs[i];
+            }
+            *--last = static_cast<char>('0' + v);
+            return last;
+        }
+
+        template<std::size_t N>
+        char *write_limbs_backward(char *last, std::uint64_t (&w)[N]) noexcept {
+            std::size_t n = N;
+            while (n > 0 && w[n - 1] == 0) --n;
+
+            while (n > 1) {
+                std::uint64_t rem = 0;
+                for (std::size_t i = n; i-- > 0;) {
+                    w[i] = div_128_64(rem, w[i], pow10_19, rem);
+                }
+                while (n > 0 && w[n - 1] == 0) --n;
+                last = write_u64_padded19_backward(last, rem);
+            }
+
+            return write_u64_backward(last, n == 0 ? 0 : w[0]);
+        }
+
+        inline std::to_chars_result copy_chars(char *first, char *last,
+                                               const char *begin, const char *end) noexcept {
+            const auto len = static_cast<std::size_t>(end - begin);
+            if (static_cast<std::size_t>(last - first) < len) {
+                return {last, std::errc::value_too_large};
+            }
+            std::memcpy(first, begin, len);
+            return {first + len, std::errc{}};
+        }
+    } // namespace detail
+
     class uint128 {
     public:
         constexpr uint128() noexcept = default;
@@ -266,23 +383,19 @@ namespace usub::umath {
             return *this;
         }
 
-        [[nodiscard]] std::string to_string() const {
-            if (hi_ == 0 && lo_ == 0) {
-                return "0";
-            }
+        static constexpr std::size_t max_chars = 39;
 
-            uint128 tmp = *this;
-            std::string res;
-            res.reserve(40);
-
-            while (tmp.hi_ != 0 || tmp.lo_ != 0) {
-                uint64_t digit = (tmp % uint128(0, 10)).low();
-                res.push_back(static_cast<char>('0' + digit));
-                tmp /= uint128(0, 10);
-            }
+        std::to_chars_result to_chars(char *first, char *last) const noexcept {
+            char buf[max_chars];
+            std::uint64_t w[2] = {lo_, hi_};
+            const char *begin = detail::write_limbs_backward(buf + max_chars, w);
+            return detail::copy_chars(first, last, begin, buf + max_chars);
+        }
 
-            std::ranges::reverse(res);
-            return res;
+        [[nodiscard]] std::string to_string() const {
+            char buf[max_chars];
+            const auto res = to_chars(buf, buf + max_chars);
+            return {buf, res.ptr};
         }
 
     private:
@@ -414,7 +527,12 @@ namespace usub::umath {
             return lo_;
         }
 
-        [[nodiscard]] constexpr auto operator<=>(const int128 &) const noexcept = default;
+        [[nodiscard]] constexpr bool operator==(const int128 &) const noexcept = default;
+
+        [[nodiscard]] constexpr std::strong_ordering operator<=>(const int128 &o) const noexcept {
+            if (hi_ != o.hi_) return static_cast<int64_t>(hi_) <=> static_cast<int64_t>(o.hi_);
+            return lo_ <=> o.lo_;
+        }
 
         friend constexpr int128 operator+(int128 a, int128 b) noexcept {
 #if defined(__SIZEOF_INT128__)
@@ -632,42 +750,23 @@ namespace usub::umath {
             return *this;
         }
 
-        [[nodiscard]] std::string to_string() const {
-            if (hi_ == 0 && lo_ == 0) {
-                return "0";
-            }
-            bool neg = (static_cast<int64_t>(hi_) < 0);
-            int128 tmp = *this;
-            if (neg) {
-                tmp = -tmp;
-            }
-
-            std::string res;
-            res.reserve(40);
+        static constexpr std::size_t max_chars = uint128::max_chars + 1;
 
-            while (tmp.hi_ != 0 || tmp.lo_ != 0) {
-                uint128 u(tmp.hi_, tmp.lo_);
-                uint128 q{};
-                uint128 r{};
-#if defined(__SIZEOF_INT128__)
-                uint128 d(0, 10);
-                q = u / d;
-                r = u % d;
-#else
-                uint128 d(0, 10);
-                uint128::div_mod(u, d, q, r);
-#endif
-                uint64_t digit = r.low();
-                res.push_back(static_cast<char>('0' + digit));
-                tmp = int128(static_cast<int64_t>(q.high()), q.low());
+        std::to_chars_result to_chars(char *first, char *last) const noexcept {
+            if (static_cast<int64_t>(hi_) >= 0) {
+                return uint128(hi_, lo_).to_chars(first, last);
             }
-
-            if (neg) {
-                res.push_back('-');
+            if (first == last) {
+                return {last, std::errc::value_too_large};
             }
+            *first = '-';
+            return unsigned_abs(*this).to_chars(first + 1, last);
+        }
 
-            std::ranges::reverse(res);
-            return res;
+        [[nodiscard]] std::string to_string() const {
+            char buf[max_chars];
+            const auto res = to_chars(buf, buf + max_chars);
+            return {buf, res.ptr};
         }
 
     private:
@@ -1006,24 +1105,125 @@ namespace usub::umath {
             return *this;
         }
 
+        static constexpr std::size_t max_chars = 78;
+
+        std::to_chars_result to_chars(char *first, char *last) const noexcept {
+            char buf[max_chars];
+            std::uint64_t w[4] = {lo_.low(), lo_.high(), hi_.low(), hi_.high()};
+            const char *begin = detail::write_limbs_backward(buf + max_chars, w);
+            return detail::copy_chars(first, last, begin, buf + max_chars);
+        }
+
         [[nodiscard]] std::string to_string() const {
-            if (hi_ == uint128(0, 0) && lo_ == uint128(0, 0)) {
-                return "0";
+            char buf[max_chars];
+            const auto res = to_chars(buf, buf + max_chars);
+            return {buf, res.ptr};
+        }
+
+        static inline void div_mod(uint256 dividend, uint256 divisor, uint256 &q, uint256 &r) noexcept {
+            const uint256 zero(uint128(0, 0), uint128(0, 0));
+
+            if (divisor == zero) {
+                q = zero;
+                r = zero;
+                return;
+            }
+            if (dividend < divisor) {
+                q = zero;
+                r = dividend;
+                return;
+            }
+            if (dividend == divisor) {
+                q = uint256(uint128(0, 0), uint128(0, 1));
+                r = zero;
+                return;
             }
 
-            uint256 tmp = *this;
-            std::string res;
-            res.reserve(80);
+            std::uint64_t u[5] = {
+                dividend.lo_.low(), dividend.lo_.high(), dividend.hi_.low(), dividend.hi_.high(), 0
+            };
+            const std::uint64_t v[4] = {
+                divisor.lo_.low(), divisor.lo_.high(), divisor.hi_.low(), divisor.hi_.high()
+            };
+            std::uint64_t qw[4] = {0, 0, 0, 0};
+
+            const int m = limb_count(u);
+            const int n = limb_count(v);
 
-            const uint256 ten(uint128(0, 0), uint128(0, 10));
-            while (tmp.hi_ != uint128(0, 0) || tmp.lo_ != uint128(0, 0)) {
-                const uint256 digit = tmp % ten;
-                res.push_back(static_cast<char>('0' + static_cast<unsigned>(digit.lo_.low())));
-                tmp /= ten;
+            if (n == 1) {
+                std::uint64_t rem = 0;
+                for (int i = m; i-- > 0;) {
+                    qw[i] = detail::div_128_64(rem, u[i], v[0], rem);
+                }
+                q = uint256(uint128(qw[3], qw[2]), uint128(qw[1], qw[0]));
+                r = uint256(uint128(0, 0), uint128(0, rem));
+                return;
             }
 
-            std::ranges::reverse(res);
-            return res;
+            const int s = std::countl_zero(v[n - 1]);
+            std::uint64_t vn[4] = {0, 0, 0, 0};
+            for (int i = n - 1; i > 0; --i) vn[i] = shl_pair(v[i], v[i - 1], s);
+            vn[0] = v[0] << s;
+
+            u[m] = shl_pair(0, u[m - 1], s);
+            for (int i = m - 1; i > 0; --i) u[i] = shl_pair(u[i], u[i - 1], s);
+            u[0] <<= s;
+
+            for (int j = m - n; j >= 0; --j) {
+                std::uint64_t qhat;
+                std::uint64_t rhat;
+                bool rhat_overflow = false;
+
+                if (u[j + n] >= vn[n - 1]) {
+                    qhat = ~std::uint64_t{0};
+                    rhat = u[j + n - 1] + vn[n - 1];
+                    rhat_overflow = rhat < vn[n - 1];
+                } else {
+                    qhat = detail::div_128_64(u[j + n], u[j + n - 1], vn[n - 1], rhat);
+                }
+
+                while (!rhat_overflow &&
+                       uint128(0, qhat) * uint128(0, vn[n - 2]) > uint128(rhat, u[j + n - 2])) {
+                    --qhat;
+                    rhat += vn[n - 1];
+                    rhat_overflow = rhat < vn[n - 1];
+                }
+
+                std::uint64_t carry = 0;
+                std::uint64_t borrow = 0;
+                for (int i = 0; i < n; ++i) {
+                    const uint128 p = uint128(0, qhat) * uint128(0, vn[i]) + uint128(0, carry);
+                    carry = p.high();
+                    const std::uint64_t t = u[i + j] - p.low();
+                    const std::uint64_t b1 = (u[i + j] < p.low()) ? 1U : 0U;
+                    u[i + j] = t - borrow;
+                    borrow = b1 + ((t < borrow) ? 1U : 0U);
+                }
+                const std::uint64_t top = carry + borrow;
+                const bool negative = u[j + n] < top;
+                u[j + n] -= top;
+
+                if (negative) {
+                    --qhat;
+                    std::uint64_t c = 0;
+                    for (int i = 0; i < n; ++i) {
+                        const std::uint64_t t = u[i + j] + vn[i];
+                        const std::uint64_t c1 = (t < vn[i]) ? 1U : 0U;
+                        u[i + j] = t + c;
+                        c = c1 + ((u[i + j] < c) ? 1U : 0U);
+                    }
+                    u[j + n] += c;
+                }
+
+                qw[j] = qhat;
+            }
+
+            std::uint64_t rw[4] = {0, 0, 0, 0};
+            for (int i = 0; i < n - 1; ++i) rw[i] = shr_pair(u[i + 1], u[i], s);
+            rw[n - 1] = u[n - 1] >> s;
+
+            q = uint256(uint128(qw[3], qw[2]), uint128(qw[1], qw[0]));
+            r = uint256(uint128(rw[3], rw[2]), uint128(rw[1], rw[0]));
         }
 
     private:
@@ -1117,54 +1317,19 @@ namespace usub::umath {
         }
 #endif
 
-        static inline int msb128(uint128 v) noexcept {
-            if (v.high() != 0) return 64 + (63 - std::countl_zero(v.high()));
-            if (v.low() != 0) return 63 - std::countl_zero(v.low());
-            return -1;
+        template<std::size_t N>
+        static constexpr int limb_count(const std::uint64_t (&w)[N]) noexcept {
+            int n = static_cast<int>(N);
+            while (n > 0 && w[n - 1] == 0) --n;
+            return n;
         }
 
-        static inline int msb(uint256 v) noexcept {
-            const int mh = msb128(v.hi_);
-            if (mh >= 0) return 128 + mh;
-            return msb128(v.lo_);
+        static constexpr std::uint64_t shl_pair(std::uint64_t hi, std::uint64_t lo, int s) noexcept {
+            return s == 0 ? hi : (hi << s) | (lo >> (64 - s));
         }
 
-        static inline void div_mod(uint256 dividend, uint256 divisor, uint256 &q, uint256 &r) noexcept {
-            const uint256 zero(uint128(0, 0), uint128(0, 0));
-
-            if (divisor == zero) {
-                q = zero;
-                r = zero;
-                return;
-            }
-            if (dividend < divisor) {
-                q = zero;
-                r = dividend;
-                return;
-            }
-            if (dividend == divisor) {
-                q = uint256(uint128(0, 0), uint128(0, 1));
-                r = zero;
-                return;
-            }
-
-            int shift = msb(dividend) - msb(divisor);
-            uint256 denom = divisor << shift;
-
-            q = zero;
-
-            const uint256 one(uint128(0, 0), uint128(0, 1));
-
-            while (shift >= 0) {
-                if (dividend >= denom) {
-                    dividend -= denom;
-                    q = q | (one << shift);
-                }
-                denom >>= 1;
-                --shift;
-            }
-
-            r = dividend;
+        static constexpr std::uint64_t shr_pair(std::uint64_t hi, std::uint64_t lo, int s) noexcept {
+            return s == 0 ? lo : (lo >> s) | (hi << (64 - s));
         }
     };
 
@@ -1414,27 +1579,23 @@ namespace usub::umath {
             return *this;
         }
 
-        [[nodiscard]] std::string to_string() const {
-            if (hi_ == uint128(0, 0) && lo_ == uint128(0, 0)) {
-                return "0";
-            }
-
-            const bool neg = is_negative();
-            uint256 tmp = neg ? unsigned_abs(*this) : uint256(hi_, lo_);
-
-            std::string res;
-            res.reserve(80);
+        static constexpr std::size_t max_chars = 78;
 
-            const uint256 ten(uint128(0, 0), uint128(0, 10));
-            while (tmp.high() != uint128(0, 0) || tmp.low() != uint128(0, 0)) {
-                const uint256 digit = tmp % ten;
-                res.push_back(static_cast<char>('0' + static_cast<unsigned>(digit.low().low())));
-                tmp /= ten;
+        std::to_chars_result to_chars(char *first, char *last) const noexcept {
+            if (!is_negative()) {
+                return uint256(hi_, lo_).to_chars(first, last);
             }
+            if (first == last) {
+                return {last, std::errc::value_too_large};
+            }
+            *first = '-';
+            return unsigned_abs(*this).to_chars(first + 1, last);
+        }
 
-            if (neg) res.push_back('-');
-            std::ranges::reverse(res);
-            return res;
+        [[nodiscard]] std::string to_string() const {
+            char buf[max_chars];
+            const auto res = to_chars(buf, buf + max_chars);
+            return {buf, res.ptr};
         }
 
     private:
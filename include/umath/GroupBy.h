@@ -0,0 +1,236 @@
+#ifndef UNUMBER_GROUP_BY_H
+#define UNUMBER_GROUP_BY_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "Numeric.h"
+#include "NumericColumn.h"
+
+namespace usub::umath {
+    namespace detail {
+        // std::hash of the key run through the murmur3 finalizer, so identity hashes of integer keys still spread
+        // over the low (bucket) and high (tag) bits.
+        template<class Key>
+        struct group_hash {
+            std::uint64_t operator()(const Key &k) const noexcept {
+                auto h = static_cast<std::uint64_t>(std::hash<Key>{}(k));
+                h ^= h >> 33;
+                h *= 0xff51afd7ed558ccdULL;
+                h ^= h >> 33;
+                h *= 0xc4ceb9fe1a85ec53ULL;
+                h ^= h >> 33;
+                return h;
+            }
+        };
+
+        // One cache line of the hash index: eight 32-bit hash tags (0 marks a free slot) and the positions of
+        // the matching groups.
+        struct alignas(64) group_bucket {
+            static constexpr std::size_t slots = 8;
+
+            std::uint32_t tag[slots]{};
+            std::uint32_t group[slots]{};
+        };
+
+        static_assert(sizeof(group_bucket) == 64);
+
+        // Rows hashed ahead of their lookups in update(); their buckets are prefetched meanwhile.
+        inline constexpr std::size_t group_batch = 16;
+    } // namespace detail
+
+    // GROUP BY key computing COUNT, SUM, MIN and MAX of Numeric128<P,S> values. Groups live in a dense array
+    // in first-seen order with the exact sum kept inline as an int256, so no row can overflow it. They are
+    // found through an open-addressing index of cache-line buckets, probed linearly. Tables filled on different
+    // threads combine with merge(); the aggregates of a key do not depend on row or merge order. A group that
+    // saw error values reports the lowest of them (Invalid, then Overflow, then DivByZero) from sum/min/max, so
+    // the error does not depend on order either; COUNT counts every row.
+    template<int P, int S, class Key = std::uint64_t, class Hash = detail::group_hash<Key>>
+    class GroupAggregate {
+    public:
+        using value_type = Numeric128<P, S>;
+        using key_type = Key;
+
+        struct result_type {
+            Key key;
+            std::uint64_t count;
+            Numeric256<76, S> sum;
+            value_type min;
+            value_type max;
+        };
+
+        explicit GroupAggregate(std::size_t expected_groups = 0, Hash hash = Hash{}) : hash_(std::move(hash)) {
+            reserve(expected_groups);
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept { return groups_.size(); }
+        [[nodiscard]] bool empty() const noexcept { return groups_.empty(); }
+
+        void reserve(std::size_t groups) {
+            groups_.reserve(groups);
+            std::size_t want = 1;
+            while (want * max_load_ < groups) want *= 2;
+            if (want > buckets_.size()) rehash_(want);
+        }
+
+        void clear() noexcept {
+            groups_.clear();
+            std::fill(buckets_.begin(), buckets_.end(), detail::group_bucket{});
+        }
+
+        void update(const Key &key, const value_type &v) {
+            add_(state_for_(key, hash_(key)), raw_of_(v), v.error());
+        }
+
+        // Rows are hashed in batches and their buckets prefetched before the lookups. Extra keys or values
+        // beyond the shorter span are ignored.
+        void update(std::span<const Key> keys, std::span<const value_type> values) {
+            update_rows_(std::min(keys.size(), values.size()), keys,
+                         [&values](std::size_t i) { return std::pair{raw_of_(values[i]), values[i].error()}; });
+        }
+
+        void update(std::span<const Key> keys, const Numeric128Column<P, S> &values) {
+            update_rows_(std::min(keys.size(), values.size()), keys,
+                         [&values](std::size_t i) { return std::pair{values.raw(i), values.error(i)}; });
+        }
+
+        void merge(const GroupAggregate &o) {
+            for (const state &g: o.groups_) {
+                state &t = state_for_(g.key, g.hash);
+                t.sum += g.sum;
+                t.count += g.count;
+                if (g.min < t.min) t.min = g.min;
+                if (t.max < g.max) t.max = g.max;
+                keep_error_(t.err, g.err);
+            }
+        }
+
+        // Groups in first-seen order.
+        [[nodiscard]] result_type operator[](std::size_t i) const noexcept { return result_(groups_[i]); }
+
+        [[nodiscard]] std::optional<result_type> find(const Key &key) const {
+            if (buckets_.empty()) return std::nullopt;
+            const std::uint64_t h = hash_(key);
+            const std::uint32_t tag = tag_of_(h);
+            for (std::size_t b = h & (buckets_.size() - 1);; b = (b + 1) & (buckets_.size() - 1)) {
+                const detail::group_bucket &bk = buckets_[b];
+                for (std::size_t s = 0; s < detail::group_bucket::slots; ++s) {
+                    if (bk.tag[s] == 0) return std::nullopt;
+                    if (bk.tag[s] == tag && groups_[bk.group[s]].key == key) return result_(groups_[bk.group[s]]);
+                }
+            }
+        }
+
+    private:
+        struct state {
+            int256 sum{};
+            int128 min = (std::numeric_limits<int128>::max)();
+            int128 max = (std::numeric_limits<int128>::min)();
+            std::uint64_t count = 0;
+            std::uint64_t hash = 0;
+            Err err = Err::None;
+            Key key;
+        };
+
+        // Groups per bucket before the index doubles (7 of 8 slots).
+        static constexpr std::size_t max_load_ = 7;
+
+        std::vector<state> groups_;
+        std::vector<detail::group_bucket> buckets_;
+        [[no_unique_address]] Hash hash_;
+
+        static int128 raw_of_(const value_type &v) noexcept { return v.ok() ? v.raw() : int128{0}; }
+
+        static std::uint32_t tag_of_(std::uint64_t h) noexcept { return static_cast<std::uint32_t>(h >> 32) | 1U; }
+
+        static void keep_error_(Err &kept, Err e) noexcept {
+            if (e != Err::None && (kept == Err::None || e < kept)) kept = e;
+        }
+
+        static void add_(state &g, const int128 &raw, Err e) noexcept {
+            ++g.count;
+            if (e != Err::None) {
+                keep_error_(g.err, e);
+                return;
+            }
+            g.sum += detail::widen_i256(raw);
+            if (raw < g.min) g.min = raw;
+            if (g.max < raw) g.max = raw;
+        }
+
+        result_type result_(const state &g) const noexcept {
+            using sum_t = Numeric256<76, S>;
+            if (g.err != Err::None) {
+                return {g.key, g.count, detail::numeric_access::make<sum_t>(int256{0}, g.err),
+                        detail::numeric_access::make<value_type>(int128{0}, g.err),
+                        detail::numeric_access::make<value_type>(int128{0}, g.err)};
+            }
+            return {g.key, g.count, detail::numeric_access::make<sum_t>(g.sum, Err::None),
+                    detail::numeric_access::make<value_type>(g.min, Err::None),
+                    detail::numeric_access::make<value_type>(g.max, Err::None)};
+        }
+
+        template<class Row>
+        void update_rows_(std::size_t n, std::span<const Key> keys, const Row &row) {
+            std::uint64_t hashes[detail::group_batch];
+            for (std::size_t i0 = 0; i0 < n; i0 += detail::group_batch) {
+                const std::size_t m = std::min(detail::group_batch, n - i0);
+                if (buckets_.empty()) rehash_(1);
+                for (std::size_t i = 0; i < m; ++i) {
+                    hashes[i] = hash_(keys[i0 + i]);
+#if defined(__GNUC__) || defined(__clang__)
+                    __builtin_prefetch(&buckets_[hashes[i] & (buckets_.size() - 1)]);
+#endif
+                }
+                for (std::size_t i = 0; i < m; ++i) {
+                    const auto [raw, e] = row(i0 + i);
+                    add_(state_for_(keys[i0 + i], hashes[i]), raw, e);
+                }
+            }
+        }
+
+        // The group for key, appended if new. Grows the index first if one more group would exceed the load.
+        state &state_for_(const Key &key, std::uint64_t h) {
+            if (groups_.size() >= buckets_.size() * max_load_) rehash_(std::max<std::size_t>(1, buckets_.size() * 2));
+            const std::uint32_t tag = tag_of_(h);
+            for (std::size_t b = h & (buckets_.size() - 1);; b = (b + 1) & (buckets_.size() - 1)) {
+                detail::group_bucket &bk = buckets_[b];
+                for (std::size_t s = 0; s < detail::group_bucket::slots; ++s) {
+                    if (bk.tag[s] == tag && groups_[bk.group[s]].key == key) return groups_[bk.group[s]];
+                    if (bk.tag[s] == 0) {
+                        bk.tag[s] = tag;
+                        bk.group[s] = static_cast<std::uint32_t>(groups_.size());
+                        groups_.push_back(state{.hash = h, .key = key});
+                        return groups_.back();
+                    }
+                }
+            }
+        }
+
+        void rehash_(std::size_t nbuckets) {
+            buckets_.assign(nbuckets, detail::group_bucket{});
+            for (std::size_t i = 0; i < groups_.size(); ++i) {
+                const std::uint64_t h = groups_[i].hash;
+                for (std::size_t b = h & (nbuckets - 1);; b = (b + 1) & (nbuckets - 1)) {
+                    detail::group_bucket &bk = buckets_[b];
+                    const auto free = std::find(std::begin(bk.tag), std::end(bk.tag), 0U);
+                    if (free != std::end(bk.tag)) {
+                        const auto s = static_cast<std::size_t>(free - std::begin(bk.tag));
+                        bk.tag[s] = tag_of_(h);
+                        bk.group[s] = static_cast<std::uint32_t>(i);
+                        break;
+                    }
+                }
+            }
+        }
+    };
+} // namespace usub::umath
+
+#endif // UNUMBER_GROUP_BY_H
@@ -7,16 +7,33 @@
 
 #include <ranges>
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <bit>
+#include <charconv>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <expected>
+#include <initializer_list>
+#include <iterator>
 #include <limits>
+#include <memory_resource>
+#include <mutex>
 #include <ostream>
+#include <span>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <vector>
 #include <concepts>
+#include <cstring>
 #include <type_traits>
+#include <utility>
+
+#if defined(__SSE4_1__)
+#include <immintrin.h>
+#endif
 
 #include "ExtendedInt.h"
 
@@ -36,13 +53,25 @@ namespace usub::umath {
         HalfUp,
     };
 
+    // Outcome of Numeric128::parse_batch: fields parsed into out, and how many of them hold an error.
+    struct parse_batch_result {
+        std::size_t parsed = 0;
+        std::size_t failed = 0;
+    };
+
     namespace detail {
+        // Builds values from raw parts for the aggregate and expression helpers; defined after the types.
+        struct numeric_access;
+
+        inline constexpr auto pow10_u_table = [] {
+            std::array<uint128, 39> t{};
+            t[0] = uint128{0, 1};
+            for (std::size_t k = 1; k < t.size(); ++k) t[k] = (t[k - 1] << 3) + (t[k - 1] << 1);
+            return t;
+        }();
+
         constexpr uint128 pow10_u(unsigned k) {
-            uint128 r{0, 1};
-            for (unsigned i = 0; i < k; ++i) {
-                r *= uint128{0, 10};
-            }
-            return r;
+            return pow10_u_table[k];
         }
 
         constexpr int128 pow10_i(unsigned k) {
@@ -67,13 +96,12 @@ namespace usub::umath {
             return -1;
         }
 
-        inline bool fits_precision(int128 raw, int P) noexcept {
-            if (P <= 0) return false;
-            if (raw.high() == 0 && raw.low() == 0) return true;
+        template<int P>
+        inline constexpr uint128 precision_bound_u = pow10_u_table[P];
 
-            uint128 a = abs_u(raw);
-            uint128 lim = pow10_u(static_cast<unsigned>(P));
-            return a < lim;
+        template<int P>
+        inline bool fits_precision(int128 raw) noexcept {
+            return abs_u(raw) < precision_bound_u<P>;
         }
 
         inline bool safe_mul_128(int128 a, int128 b) noexcept {
@@ -85,16 +113,137 @@ namespace usub::umath {
             return (ma + mb) < 127;
         }
 
-        inline uint128 div_u(uint128 num, uint128 den, uint128 &rem) {
-            rem = num % den;
-            return num / den;
-        }
-
         inline int128 apply_sign(uint128 mag, bool neg) {
             int128 r(mag);
             return neg ? -r : r;
         }
 
+        template<std::size_t N>
+        char *write_fixed_backward(char *last, std::uint64_t (&w)[N], int width) noexcept {
+            char *p = write_limbs_backward(last, w);
+            while (last - p < width) *--p = '0';
+            return p;
+        }
+
+        inline bool is_digit(char c) noexcept {
+            return c >= '0' && c <= '9';
+        }
+
+        inline const char *scan_decimal(const char *first, const char *last) noexcept {
+            const char *p = first;
+            if (p != last && (*p == '+' || *p == '-')) ++p;
+
+            bool any = false;
+            while (p != last && is_digit(*p)) {
+                ++p;
+                any = true;
+            }
+            if (p != last && *p == '.') {
+                ++p;
+                while (p != last && is_digit(*p)) {
+                    ++p;
+                    any = true;
+                }
+            }
+            return any ? p : first;
+        }
+
+        inline bool parse_8_digits(const char *p, std::uint64_t &out) noexcept {
+            if constexpr (std::endian::native == std::endian::little) {
+                std::uint64_t v;
+                std::memcpy(&v, p, 8);
+                if (((v & 0xF0F0F0F0F0F0F0F0ULL) |
+                     (((v + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) != 0x3333333333333333ULL)
+                    return false;
+                v -= 0x3030303030303030ULL;
+                v = v * 10 + (v >> 8);
+                v = (((v & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+                     (((v >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+                out = v;
+                return true;
+            } else {
+                std::uint64_t v = 0;
+                for (int i = 0; i < 8; ++i) {
+                    if (!is_digit(p[i])) return false;
+                    v = v * 10 + static_cast<std::uint64_t>(p[i] - '0');
+                }
+                out = v;
+                return true;
+            }
+        }
+
+        // The SSE4.1 step is chosen at compile time only. A run-time dispatched version cannot be inlined into
+        // the parser, and the call cost more than the SIMD step saves over two SWAR steps.
+        inline bool parse_16_digits(const char *p, std::uint64_t &out) noexcept {
+#if defined(__SSE4_1__)
+            const __m128i d = _mm_sub_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p)), _mm_set1_epi8('0'));
+            const __m128i nine = _mm_set1_epi8(9);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(d, nine), nine)) != 0xFFFF) return false;
+
+            const __m128i t1 = _mm_maddubs_epi16(d, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1));
+            const __m128i t2 = _mm_madd_epi16(t1, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+            const __m128i t3 = _mm_packus_epi32(t2, t2);
+            const __m128i t4 = _mm_madd_epi16(t3, _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1));
+            out = static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm_cvtsi128_si32(t4))) * 100000000ULL +
+                  static_cast<std::uint32_t>(_mm_extract_epi32(t4, 1));
+            return true;
+#else
+            std::uint64_t hi, lo;
+            if (!parse_8_digits(p, hi) || !parse_8_digits(p + 8, lo)) return false;
+            out = hi * 100000000ULL + lo;
+            return true;
+#endif
+        }
+
+        // Accumulates up to `max` leading digits of [p, last) into acc; returns the first unconsumed position.
+        inline const char *accumulate_digits(const char *p, const char *last, std::size_t max, uint128 &acc) noexcept {
+            std::uint64_t v;
+            while (max >= 16 && last - p >= 16 && parse_16_digits(p, v)) {
+                acc = acc * pow10_u(16) + uint128{0, v};
+                p += 16;
+                max -= 16;
+            }
+            while (max >= 8 && last - p >= 8 && parse_8_digits(p, v)) {
+                acc = acc * pow10_u(8) + uint128{0, v};
+                p += 8;
+                max -= 8;
+            }
+            while (max != 0 && p != last && is_digit(*p)) {
+                acc = acc * uint128{0, 10} + uint128{0, static_cast<std::uint64_t>(*p - '0')};
+                ++p;
+                --max;
+            }
+            return p;
+        }
+
+        // The same for magnitudes that stay below 10^19 (max plus the digits already in acc at most 19).
+        inline const char *accumulate_digits(const char *p, const char *last, std::size_t max,
+                                             std::uint64_t &acc) noexcept {
+            std::uint64_t v;
+            while (max >= 8 && last - p >= 8 && parse_8_digits(p, v)) {
+                acc = acc * 100000000ULL + v;
+                p += 8;
+                max -= 8;
+            }
+            while (max != 0 && p != last && is_digit(*p)) {
+                acc = acc * 10U + static_cast<std::uint64_t>(*p - '0');
+                ++p;
+                --max;
+            }
+            return p;
+        }
+
+        inline const char *skip_digits(const char *p, const char *last) noexcept {
+            std::uint64_t v;
+            while (last - p >= 8 && parse_8_digits(p, v)) p += 8;
+            while (p != last && is_digit(*p)) ++p;
+            return p;
+        }
+
+        inline std::errc to_errc(Err e) noexcept {
+            return e == Err::Overflow ? std::errc::result_out_of_range : std::errc::invalid_argument;
+        }
+
         inline int msb_u256(uint256 v) noexcept {
             const uint128 hi = v.high();
             if (hi.high() != 0) return 192 + (63 - std::countl_zero(hi.high()));
@@ -105,11 +254,115 @@ namespace usub::umath {
             return -1;
         }
 
+        inline constexpr auto pow10_u256_table = [] {
+            std::array<uint256, 78> t{};
+            t[0] = uint256{1U};
+            for (std::size_t k = 1; k < t.size(); ++k) t[k] = (t[k - 1] << 3) + (t[k - 1] << 1);
+            return t;
+        }();
+
         constexpr uint256 pow10_u256(unsigned k) {
+            return pow10_u256_table[k];
+        }
+
+        struct pow10_divisor {
+            std::uint64_t value;
+            std::uint64_t norm;
+            std::uint64_t inv;
+            int shift;
+        };
+
+        constexpr std::uint64_t reciprocal_2by1(std::uint64_t d) noexcept {
+            std::uint64_t r = ~d;
+            std::uint64_t q = 0;
+            for (int i = 0; i < 64; ++i) {
+                const bool carry = (r >> 63) != 0;
+                r = (r << 1) | 1U;
+                q <<= 1;
+                if (carry || r >= d) {
+                    r -= d;
+                    q |= 1U;
+                }
+            }
+            return q;
+        }
+
+        inline constexpr std::size_t pow10_divisor_max = 19;
+
+        inline constexpr auto pow10_divisors = [] {
+            std::array<pow10_divisor, pow10_divisor_max + 1> t{};
+            std::uint64_t p = 1;
+            for (std::size_t k = 0; k <= pow10_divisor_max; ++k) {
+                const int sh = std::countl_zero(p);
+                t[k] = {p, p << sh, reciprocal_2by1(p << sh), sh};
+                p *= 10U;
+            }
+            return t;
+        }();
+
+        inline std::uint64_t div_2by1_preinv(std::uint64_t u1, std::uint64_t u0,
+                                             const pow10_divisor &d, std::uint64_t &rem) noexcept {
+            const uint128 qq = uint128{0, d.inv} * uint128{0, u1} + uint128{u1 + 1U, u0};
+            std::uint64_t q = qq.high();
+            std::uint64_t r = u0 - q * d.norm;
+            if (r > qq.low()) {
+                --q;
+                r += d.norm;
+            }
+            if (r >= d.norm) {
+                ++q;
+                r -= d.norm;
+            }
+            rem = r;
+            return q;
+        }
+
+        template<std::size_t N>
+        std::uint64_t divrem_pow10_limbs(std::uint64_t (&w)[N], unsigned k) noexcept {
+            const pow10_divisor &d = pow10_divisors[k];
+            const int sh = d.shift;
+
+            std::size_t n = N;
+            while (n > 0 && w[n - 1] == 0) --n;
+            if (n == 0) return 0;
+
+            std::uint64_t r = (sh == 0) ? 0 : (w[n - 1] >> (64 - sh));
+            for (std::size_t i = n; i-- > 0;) {
+                std::uint64_t u0 = w[i] << sh;
+                if (sh != 0 && i > 0) u0 |= w[i - 1] >> (64 - sh);
+                w[i] = div_2by1_preinv(r, u0, d, r);
+            }
+            return r >> sh;
+        }
+
+        inline uint128 div_pow10_u(uint128 num, unsigned k, uint128 &rem) noexcept {
+            std::uint64_t w[2] = {num.low(), num.high()};
+            uint128 r{0, 0};
+            uint128 weight{0, 1};
+            while (k > 0) {
+                const auto step = static_cast<unsigned>(std::min<std::size_t>(k, pow10_divisor_max));
+                const std::uint64_t rs = divrem_pow10_limbs(w, step);
+                r += uint128{0, rs} * weight;
+                weight *= uint128{0, pow10_divisors[step].value};
+                k -= step;
+            }
+            rem = r;
+            return {w[1], w[0]};
+        }
+
+        inline uint256 div_pow10_u256(uint256 num, unsigned k, uint256 &rem) noexcept {
+            std::uint64_t w[4] = {num.low().low(), num.low().high(), num.high().low(), num.high().high()};
             uint256 r{0U};
-            r = uint256{1U};
-            for (unsigned i = 0; i < k; ++i) r *= uint256{10U};
-            return r;
+            uint256 weight{1U};
+            while (k > 0) {
+                const auto step = static_cast<unsigned>(std::min<std::size_t>(k, pow10_divisor_max));
+                const std::uint64_t rs = divrem_pow10_limbs(w, step);
+                r += uint256{rs} * weight;
+                weight *= uint256{pow10_divisors[step].value};
+                k -= step;
+            }
+            rem = r;
+            return {uint128{w[3], w[2]}, uint128{w[1], w[0]}};
         }
 
         inline uint256 abs_u256(int256 v) noexcept {
@@ -118,12 +371,12 @@ namespace usub::umath {
             return uint256{0U} - u;
         }
 
-        inline bool fits_precision_i256(int256 raw, int P) noexcept {
-            if (P <= 0) return false;
-            if (raw.high() == uint128{0, 0} && raw.low() == uint128{0, 0}) return true;
-            const uint256 a = abs_u256(raw);
-            const uint256 lim = pow10_u256(static_cast<unsigned>(P));
-            return a < lim;
+        template<int P>
+        inline constexpr uint256 precision_bound_u256 = pow10_u256_table[P];
+
+        template<int P>
+        inline bool fits_precision_i256(int256 raw) noexcept {
+            return abs_u256(raw) < precision_bound_u256<P>;
         }
 
         inline bool safe_mul_256(uint256 a, uint256 b) noexcept {
@@ -134,8 +387,9 @@ namespace usub::umath {
         }
 
         inline uint256 div_u256(uint256 num, uint256 den, uint256 &rem) noexcept {
-            rem = num % den;
-            return num / den;
+            uint256 q{};
+            uint256::div_mod(num, den, q, rem);
+            return q;
         }
 
         inline int256 apply_sign_u256(uint256 mag, bool neg) noexcept {
@@ -143,6 +397,22 @@ namespace usub::umath {
             return neg ? -r : r;
         }
 
+        inline int256 widen_i256(const int128 &v) noexcept {
+            const std::int64_t h = v.high();
+            const std::int64_t sign = h < 0 ? -1 : 0;
+            return int256(sign, static_cast<std::uint64_t>(sign), static_cast<std::uint64_t>(h), v.low());
+        }
+
+        // v / 10^k, rounded half away from zero for HalfUp.
+        inline int256 round_pow10_i256(const int256 &v, unsigned k, Rounding rnd) noexcept {
+            if (k == 0) return v;
+            const bool neg = v.is_negative();
+            uint256 rem{};
+            uint256 q = div_pow10_u256(abs_u256(v), k, rem);
+            if (rnd == Rounding::HalfUp && rem + rem >= pow10_u256(k)) q += uint256{1U};
+            return apply_sign_u256(q, neg);
+        }
+
         inline bool safe_mul_i256(int256 a, int256 b) noexcept {
             const uint256 ua = abs_u256(a);
             const uint256 ub = abs_u256(b);
@@ -151,6 +421,416 @@ namespace usub::umath {
             if (ma < 0 || mb < 0) return true;
             return (ma + mb) < 255;
         }
+
+        template<std::uint32_t Mod>
+        constexpr std::uint32_t pow_mod(std::uint64_t b, std::uint64_t e) noexcept {
+            std::uint64_t r = 1;
+            b %= Mod;
+            for (; e != 0; e >>= 1) {
+                if (e & 1U) r = r * b % Mod;
+                b = b * b % Mod;
+            }
+            return static_cast<std::uint32_t>(r);
+        }
+
+        // Process-wide workers behind parallel_for: hardware_concurrency() - 1 threads, started on first use and
+        // joined at exit. Blocks wait in one FIFO queue. A thread waiting for its own blocks runs queued ones in
+        // the meantime, so nested parallel_for calls cannot deadlock and budgets above the pool size still finish.
+        class thread_pool {
+        public:
+            using block_fn = void (*)(void *, std::size_t);
+
+            static thread_pool &instance() {
+                static thread_pool pool(std::max(1U, std::thread::hardware_concurrency()) - 1U);
+                return pool;
+            }
+
+            explicit thread_pool(unsigned workers) {
+                workers_.reserve(workers);
+                for (unsigned i = 0; i < workers; ++i) workers_.emplace_back([this] { work_(); });
+            }
+
+            thread_pool(const thread_pool &) = delete;
+            thread_pool &operator=(const thread_pool &) = delete;
+
+            ~thread_pool() {
+                {
+                    std::lock_guard lk(m_);
+                    stop_ = true;
+                }
+                cv_.notify_all();
+            }
+
+            [[nodiscard]] std::size_t size() const noexcept { return workers_.size(); }
+
+            // Runs fn(ctx, b) for every b in [0, blocks), block 0 on the calling thread, and returns once all are
+            // done.
+            void run(std::size_t blocks, block_fn fn, void *ctx) {
+                std::atomic<std::size_t> pending{blocks - 1};
+                {
+                    std::lock_guard lk(m_);
+                    for (std::size_t b = 1; b < blocks; ++b) queue_.push_back({fn, ctx, b, &pending});
+                }
+                cv_.notify_all();
+                fn(ctx, 0);
+
+                std::unique_lock lk(m_);
+                while (pending.load(std::memory_order_acquire) != 0) {
+                    if (queue_.empty()) {
+                        cv_.wait(lk);
+                        continue;
+                    }
+                    const task t = queue_.front();
+                    queue_.pop_front();
+                    lk.unlock();
+                    execute_(t);
+                    lk.lock();
+                }
+            }
+
+        private:
+            struct task {
+                block_fn fn;
+                void *ctx;
+                std::size_t block;
+                std::atomic<std::size_t> *pending;
+            };
+
+            std::mutex m_;
+            std::condition_variable cv_;
+            std::deque<task> queue_;
+            bool stop_ = false;
+            std::vector<std::jthread> workers_; // last, so the workers are joined before the queue goes away
+
+            void execute_(const task &t) {
+                t.fn(t.ctx, t.block);
+                if (t.pending->fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    // Taking the lock keeps the waiter from missing the wakeup between its check and its wait.
+                    std::lock_guard lk(m_);
+                    cv_.notify_all();
+                }
+            }
+
+            void work_() {
+                std::unique_lock lk(m_);
+                for (;;) {
+                    cv_.wait(lk, [this] { return stop_ || !queue_.empty(); });
+                    if (queue_.empty()) return;
+                    const task t = queue_.front();
+                    queue_.pop_front();
+                    lk.unlock();
+                    execute_(t);
+                    lk.lock();
+                }
+            }
+        };
+
+        // Calls f(i) for every i in [0, n), split into min(n, threads) contiguous blocks that run on the shared
+        // thread_pool; the caller runs the first block and returns once every block is done.
+        template<class F>
+        void parallel_for(std::size_t n, unsigned threads, F &&f) {
+            const std::size_t t = std::min<std::size_t>(threads, n);
+            if (t <= 1) {
+                for (std::size_t i = 0; i < n; ++i) f(i);
+                return;
+            }
+            struct job {
+                std::remove_reference_t<F> *f;
+                std::size_t n, t;
+            } j{&f, n, t};
+            thread_pool::instance().run(t, [](void *p, std::size_t w) {
+                const job &c = *static_cast<const job *>(p);
+                for (std::size_t i = c.n * w / c.t, e = c.n * (w + 1) / c.t; i < e; ++i) (*c.f)(i);
+            }, &j);
+        }
+
+        // Transform points per thread below which a butterfly stage is not split further.
+        inline constexpr std::size_t ntt_parallel_grain = std::size_t{1} << 13;
+
+        // In-place iterative number-theoretic transform of length n (a power of two) modulo Mod, with G a
+        // primitive root of Mod. The inverse transform includes the 1/n factor.
+        template<std::uint32_t Mod, std::uint32_t G>
+        void ntt(std::uint32_t *a, std::size_t n, bool invert, std::pmr::memory_resource *mr, unsigned threads = 1) {
+            const auto blocks = static_cast<unsigned>(
+                std::max<std::size_t>(1, std::min<std::size_t>(threads, n / ntt_parallel_grain)));
+            for (std::size_t i = 1, j = 0; i < n; ++i) {
+                std::size_t bit = n >> 1;
+                for (; j & bit; bit >>= 1) j ^= bit;
+                j ^= bit;
+                if (i < j) std::swap(a[i], a[j]);
+            }
+
+            std::pmr::vector<std::uint32_t> w(n / 2, mr);
+            for (std::size_t len = 2; len <= n; len <<= 1) {
+                const std::size_t half = len / 2;
+                const std::uint32_t step = pow_mod<Mod>(G, (Mod - 1) / len);
+                const std::uint32_t root = invert ? pow_mod<Mod>(step, Mod - 2) : step;
+                w[0] = 1;
+                for (std::size_t k = 1; k < half; ++k) {
+                    w[k] = static_cast<std::uint32_t>(static_cast<std::uint64_t>(w[k - 1]) * root % Mod);
+                }
+                // Butterflies of one stage are independent; block t handles indices [n/2 * t / blocks, ...).
+                parallel_for(blocks, blocks, [&](std::size_t t) {
+                    const std::size_t lo = n / 2 * t / blocks, hi = n / 2 * (t + 1) / blocks;
+                    std::size_t i = lo / half * len, k = lo % half;
+                    for (std::size_t b = lo; b < hi; ++b) {
+                        const std::uint32_t u = a[i + k];
+                        const auto v = static_cast<std::uint32_t>(static_cast<std::uint64_t>(a[i + k + half]) * w[k] % Mod);
+                        const std::uint32_t sum = u + v;
+                        a[i + k] = sum >= Mod ? sum - Mod : sum;
+                        a[i + k + half] = u >= v ? u - v : u + Mod - v;
+                        if (++k == half) {
+                            k = 0;
+                            i += len;
+                        }
+                    }
+                });
+            }
+
+            if (invert) {
+                const std::uint64_t n_inv = pow_mod<Mod>(n, Mod - 2);
+                for (std::size_t i = 0; i < n; ++i) a[i] = static_cast<std::uint32_t>(a[i] * n_inv % Mod);
+            }
+        }
+
+        // Cyclic convolution of a and b modulo Mod over n points (n >= na + nb - 1). With threads > 1, mr must be
+        // thread-safe.
+        template<std::uint32_t Mod, std::uint32_t G>
+        std::pmr::vector<std::uint32_t> convolve_mod(const std::uint32_t *a, std::size_t na, const std::uint32_t *b,
+                                                     std::size_t nb, std::size_t n, std::pmr::memory_resource *mr,
+                                                     unsigned threads = 1) {
+            std::pmr::vector<std::uint32_t> fa(n, 0U, mr), fb(n, 0U, mr);
+            for (std::size_t i = 0; i < na; ++i) fa[i] = a[i] % Mod;
+            for (std::size_t i = 0; i < nb; ++i) fb[i] = b[i] % Mod;
+            const unsigned half = std::max(1U, threads / 2);
+            parallel_for(2, threads, [&](std::size_t i) {
+                ntt<Mod, G>(i == 0 ? fa.data() : fb.data(), n, false, mr, half);
+            });
+            for (std::size_t i = 0; i < n; ++i) {
+                fa[i] = static_cast<std::uint32_t>(static_cast<std::uint64_t>(fa[i]) * fb[i] % Mod);
+            }
+            ntt<Mod, G>(fa.data(), n, true, mr, threads);
+            return fa;
+        }
+
+        // Product of two base-1e9 magnitudes via three NTT primes and Garner's CRT. The primes' product
+        // (~7.9e25) bounds every convolution term (min(na, nb) * (1e9 - 1)^2) for up to 7.8e7 limbs, and each
+        // supports transforms of length 2^23. Writes na + nb limbs to r; the transforms allocate from mr. With
+        // threads > 1 the three convolutions (and their transforms) run concurrently and allocate from worker_mr
+        // instead, which must be thread-safe (a std::pmr resource need not be).
+        inline void mul_ntt_base1e9(const std::uint32_t *a, std::size_t na, const std::uint32_t *b, std::size_t nb,
+                                    std::uint32_t *r, std::pmr::memory_resource *mr, unsigned threads = 1,
+                                    std::pmr::memory_resource *worker_mr = std::pmr::new_delete_resource()) {
+            constexpr std::uint32_t m1 = 998244353U;
+            constexpr std::uint32_t m2 = 167772161U;
+            constexpr std::uint32_t m3 = 469762049U;
+            constexpr std::uint64_t m1_inv_m2 = pow_mod<m2>(m1, m2 - 2);
+            constexpr std::uint64_t m12_inv_m3 = pow_mod<m3>(static_cast<std::uint64_t>(m1) * m2 % m3, m3 - 2);
+            const uint128 m12 = uint128{0, static_cast<std::uint64_t>(m1) * m2};
+
+            const std::size_t n = std::bit_ceil(na + nb - 1);
+            if (threads > 1) mr = worker_mr;
+            const unsigned sub = std::max(1U, threads / 3);
+            std::pmr::vector<std::uint32_t> c1(mr), c2(mr), c3(mr);
+            parallel_for(3, threads, [&](std::size_t p) {
+                if (p == 0) c1 = convolve_mod<m1, 3>(a, na, b, nb, n, mr, sub);
+                else if (p == 1) c2 = convolve_mod<m2, 3>(a, na, b, nb, n, mr, sub);
+                else c3 = convolve_mod<m3, 3>(a, na, b, nb, n, mr, sub);
+            });
+
+            uint128 carry{};
+            for (std::size_t i = 0; i < na + nb; ++i) {
+                uint128 cur = carry;
+                if (i < n) {
+                    const std::uint64_t v1 = c1[i];
+                    const std::uint64_t v2 = (c2[i] + m2 - v1 % m2) % m2 * m1_inv_m2 % m2;
+                    const std::uint64_t low_m3 = (v1 + m1 % m3 * v2) % m3;
+                    const std::uint64_t v3 = (c3[i] + m3 - low_m3) % m3 * m12_inv_m3 % m3;
+                    cur += uint128{0, v1 + static_cast<std::uint64_t>(m1) * v2} + m12 * uint128{0, v3};
+                }
+                uint128 rem{};
+                carry = div_pow10_u(cur, 9, rem);
+                r[i] = static_cast<std::uint32_t>(rem.low());
+            }
+        }
+
+        inline std::vector<std::uint32_t> mul_ntt_base1e9(const std::uint32_t *a, std::size_t na,
+                                                          const std::uint32_t *b, std::size_t nb) {
+            std::vector<std::uint32_t> r(na + nb);
+            mul_ntt_base1e9(a, na, b, nb, r.data(), std::pmr::get_default_resource());
+            return r;
+        }
+
+        // Vector-like limb storage that keeps up to N limbs inline and only allocates once a value outgrows them.
+        // Iterators are plain pointers and are invalidated by any operation that may grow the buffer. Spills come
+        // from a memory resource that copies inherit; like the std::pmr containers, assignment keeps the
+        // target's resource.
+        template<std::size_t N>
+        class small_limbs {
+        public:
+            using value_type = std::uint32_t;
+            using size_type = std::size_t;
+            using iterator = std::uint32_t *;
+            using const_iterator = const std::uint32_t *;
+
+            small_limbs() noexcept = default;
+
+            explicit small_limbs(std::pmr::memory_resource *mr) noexcept : res_(mr) {}
+
+            explicit small_limbs(std::size_t n, std::uint32_t v = 0U,
+                                 std::pmr::memory_resource *mr = std::pmr::get_default_resource()) : res_(mr) {
+                assign(n, v);
+            }
+
+            small_limbs(const std::uint32_t *first, const std::uint32_t *last,
+                        std::pmr::memory_resource *mr = std::pmr::get_default_resource()) : res_(mr) {
+                assign(first, last);
+            }
+
+            small_limbs(std::initializer_list<std::uint32_t> il) { assign(il.begin(), il.end()); }
+
+            small_limbs(const small_limbs &o) : res_(o.res_) { assign(o.begin(), o.end()); }
+
+            small_limbs(small_limbs &&o) noexcept : res_(o.res_) { steal_(o); }
+
+            small_limbs &operator=(const small_limbs &o) {
+                if (this != &o) assign(o.begin(), o.end());
+                return *this;
+            }
+
+            // Steals o's buffer when both use the same resource. Otherwise the limbs are copied into this
+            // resource; like the other allocating noexcept paths of Numeric, a failed allocation terminates.
+            small_limbs &operator=(small_limbs &&o) noexcept {
+                if (this == &o) return *this;
+                if (o.is_inline_() || *o.res_ != *res_) {
+                    assign(o.begin(), o.end());
+                    o.size_ = 0;
+                } else {
+                    release_();
+                    steal_(o);
+                }
+                return *this;
+            }
+
+            ~small_limbs() { release_(); }
+
+            [[nodiscard]] std::size_t size() const noexcept { return size_; }
+            [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+            [[nodiscard]] std::size_t capacity() const noexcept { return cap_; }
+            [[nodiscard]] std::pmr::memory_resource *resource() const noexcept { return res_; }
+
+            std::uint32_t *data() noexcept { return data_; }
+            const std::uint32_t *data() const noexcept { return data_; }
+            iterator begin() noexcept { return data_; }
+            iterator end() noexcept { return data_ + size_; }
+            const_iterator begin() const noexcept { return data_; }
+            const_iterator end() const noexcept { return data_ + size_; }
+
+            std::uint32_t &operator[](std::size_t i) noexcept { return data_[i]; }
+            const std::uint32_t &operator[](std::size_t i) const noexcept { return data_[i]; }
+            std::uint32_t &back() noexcept { return data_[size_ - 1]; }
+            const std::uint32_t &back() const noexcept { return data_[size_ - 1]; }
+
+            void clear() noexcept { size_ = 0; }
+            void pop_back() noexcept { --size_; }
+
+            void push_back(std::uint32_t v) {
+                if (size_ == cap_) grow_(size_ + 1);
+                data_[size_++] = v;
+            }
+
+            void reserve(std::size_t n) {
+                if (n > cap_) grow_(n);
+            }
+
+            void resize(std::size_t n, std::uint32_t v = 0U) {
+                reserve(n);
+                if (n > size_) std::fill(data_ + size_, data_ + n, v);
+                size_ = n;
+            }
+
+            void assign(std::size_t n, std::uint32_t v) {
+                size_ = 0;
+                resize(n, v);
+            }
+
+            template<std::forward_iterator It>
+            void assign(It first, It last) {
+                const auto n = static_cast<std::size_t>(std::distance(first, last));
+                size_ = 0;
+                reserve(n);
+                std::copy(first, last, data_);
+                size_ = n;
+            }
+
+            // Inserts [first, last) before pos; the source must not alias this buffer.
+            template<std::forward_iterator It>
+            iterator insert(const_iterator pos, It first, It last) {
+                const auto at = static_cast<std::size_t>(pos - data_);
+                const auto n = static_cast<std::size_t>(std::distance(first, last));
+                reserve(size_ + n);
+                std::copy_backward(data_ + at, data_ + size_, data_ + size_ + n);
+                std::copy(first, last, data_ + at);
+                size_ += n;
+                return data_ + at;
+            }
+
+            iterator erase(const_iterator first, const_iterator last) noexcept {
+                const auto at = static_cast<std::size_t>(first - data_);
+                const auto n = static_cast<std::size_t>(last - first);
+                std::copy(data_ + at + n, data_ + size_, data_ + at);
+                size_ -= n;
+                return data_ + at;
+            }
+
+            void swap(small_limbs &o) noexcept {
+                small_limbs tmp(std::move(o));
+                o = std::move(*this);
+                *this = std::move(tmp);
+            }
+
+            friend bool operator==(const small_limbs &a, const small_limbs &b) noexcept {
+                return std::equal(a.begin(), a.end(), b.begin(), b.end());
+            }
+
+        private:
+            std::uint32_t *data_ = inline_;
+            std::size_t size_ = 0;
+            std::size_t cap_ = N;
+            std::pmr::memory_resource *res_ = std::pmr::get_default_resource();
+            std::uint32_t inline_[N];
+
+            [[nodiscard]] bool is_inline_() const noexcept { return data_ == inline_; }
+
+            void grow_(std::size_t need) {
+                const std::size_t cap = std::max(need, cap_ * 2);
+                auto *p = static_cast<std::uint32_t *>(res_->allocate(cap * sizeof(std::uint32_t),
+                                                                      alignof(std::uint32_t)));
+                std::copy(data_, data_ + size_, p);
+                release_();
+                data_ = p;
+                cap_ = cap;
+            }
+
+            void release_() noexcept {
+                if (!is_inline_()) res_->deallocate(data_, cap_ * sizeof(std::uint32_t), alignof(std::uint32_t));
+                data_ = inline_;
+                cap_ = N;
+            }
+
+            void steal_(small_limbs &o) noexcept {
+                if (o.is_inline_()) {
+                    std::copy(o.data_, o.data_ + o.size_, inline_);
+                } else {
+                    data_ = o.data_;
+                    cap_ = o.cap_;
+                    o.data_ = o.inline_;
+                    o.cap_ = N;
+                }
+                size_ = o.size_;
+                o.size_ = 0;
+            }
+        };
     } // namespace detail
 
     template<int P, int S>
@@ -199,37 +879,98 @@ namespace usub::umath {
             return out.checked();
         }
 
-        [[nodiscard]] int128 raw() const noexcept { return raw_; }
+        // Column-wise parsing into a caller-provided span. Each overload parses fields into out[0, parsed) and
+        // writes the status of field i to err[i] for every i < min(parsed, err.size()). Fields are parsed one by
+        // one with the scalar parser, so this saves the per-value wrappers rather than the parsing itself.
+        static parse_batch_result parse_batch(std::span<const std::string_view> in, std::span<self> out,
+                                              std::span<Err> err = {}, Rounding r = Rounding::HalfUp) noexcept {
+            const std::size_t n = std::min(in.size(), out.size());
+            for (std::size_t i = 0; i < n; ++i) out[i].init_parse(in[i], r);
+            return batch_result_(out.first(n), err);
+        }
+
+        // Field i is buf[offsets[i], offsets[i + 1]); offsets holds one more entry than there are fields. A field
+        // whose offsets decrease or run past buf is Invalid.
+        template<std::ranges::contiguous_range Offsets>
+            requires std::integral<std::ranges::range_value_t<Offsets>>
+        static parse_batch_result parse_batch(std::string_view buf, const Offsets &offsets, std::span<self> out,
+                                              std::span<Err> err = {}, Rounding r = Rounding::HalfUp) noexcept {
+            const std::size_t fields = std::ranges::empty(offsets) ? 0 : std::ranges::size(offsets) - 1;
+            const std::size_t n = std::min(fields, out.size());
+            const auto *o = std::ranges::data(offsets);
+            for (std::size_t i = 0; i < n; ++i) {
+                if (std::cmp_less(o[i], 0) || std::cmp_greater(o[i], o[i + 1]) ||
+                    std::cmp_greater(o[i + 1], buf.size())) {
+                    out[i].init_error(Err::Invalid);
+                    continue;
+                }
+                const auto b = static_cast<std::size_t>(o[i]);
+                out[i].init_parse(std::string_view(buf.data() + b, static_cast<std::size_t>(o[i + 1]) - b), r);
+            }
+            return batch_result_(out.first(n), err);
+        }
 
-        [[nodiscard]] std::string to_string() const {
-            if (!ok()) {
-                return "<err>";
+        // Splits buf on delim (a trailing delimiter does not start a new field) and parses up to out.size() fields.
+        static parse_batch_result parse_batch(std::string_view buf, char delim, std::span<self> out,
+                                              std::span<Err> err = {}, Rounding r = Rounding::HalfUp) noexcept {
+            const char *p = buf.data();
+            const char *const last = p + buf.size();
+            std::size_t n = 0;
+            while (p != last && n < out.size()) {
+                const void *hit = std::memchr(p, delim, static_cast<std::size_t>(last - p));
+                const char *e = hit ? static_cast<const char *>(hit) : last;
+                out[n++].init_parse(std::string_view(p, static_cast<std::size_t>(e - p)), r);
+                p = e == last ? last : e + 1;
             }
+            return batch_result_(out.first(n), err);
+        }
 
-            bool neg = raw_.high() < 0;
-            uint128 mag = detail::abs_u(raw_);
+        [[nodiscard]] int128 raw() const noexcept { return raw_; }
 
-            uint128 div = detail::pow10_u(static_cast<unsigned>(S));
-            uint128 int_mag = mag / div;
-            uint128 frac_mag = mag % div;
+        static constexpr std::size_t max_chars =
+                1 + static_cast<std::size_t>(P - S > 0 ? P - S : 1) + (S > 0 ? 1 + static_cast<std::size_t>(S) : 0);
 
-            std::string is = uint128(int_mag).to_string();
-            if constexpr (S == 0) {
-                return neg ? ("-" + is) : is;
+        std::to_chars_result to_chars(char *first, char *last) const noexcept {
+            if (!ok()) return {first, std::errc::invalid_argument};
+
+            const bool neg = raw_.high() < 0;
+            uint128 frac_mag{};
+            const uint128 int_mag = detail::div_pow10_u(detail::abs_u(raw_), static_cast<unsigned>(S), frac_mag);
+
+            char buf[max_chars];
+            char *p = buf + max_chars;
+            if constexpr (S > 0) {
+                std::uint64_t fw[2] = {frac_mag.low(), frac_mag.high()};
+                p = detail::write_fixed_backward(p, fw, S);
+                *--p = '.';
             }
+            std::uint64_t iw[2] = {int_mag.low(), int_mag.high()};
+            p = detail::write_limbs_backward(p, iw);
+            if (neg) *--p = '-';
 
-            std::string fs = uint128(frac_mag).to_string();
-            if (fs.size() < static_cast<std::size_t>(S)) {
-                fs.insert(fs.begin(), static_cast<std::size_t>(S) - fs.size(), '0');
+            return detail::copy_chars(first, last, p, buf + max_chars);
+        }
+
+        friend std::from_chars_result from_chars(const char *first, const char *last, self &value,
+                                                 Rounding rnd = Rounding::HalfUp) noexcept {
+            const char *end = detail::scan_decimal(first, last);
+            if (end == first) return {first, std::errc::invalid_argument};
+
+            self tmp;
+            tmp.init_parse(std::string_view(first, static_cast<std::size_t>(end - first)), rnd);
+            if (!tmp.ok()) return {end, detail::to_errc(tmp.err_)};
+            value = tmp;
+            return {end, std::errc{}};
+        }
+
+        [[nodiscard]] std::string to_string() const {
+            if (!ok()) {
+                return "<err>";
             }
 
-            std::string out;
-            out.reserve(is.size() + 1 + fs.size() + (neg ? 1 : 0));
-            if (neg) out.push_back('-');
-            out += is;
-            out.push_back('.');
-            out += fs;
-            return out;
+            char buf[max_chars];
+            const auto res = to_chars(buf, buf + max_chars);
+            return {buf, res.ptr};
         }
 
         friend inline std::ostream &operator<<(std::ostream &os, const self &v) {
@@ -352,22 +1093,17 @@ namespace usub::umath {
                 return out;
             }
 
-            int128 prod = a.raw_ * b.raw_;
-            int128 divv = detail::pow10_i(static_cast<unsigned>(S));
+            const int128 prod = a.raw_ * b.raw_;
+            const bool neg = prod.high() < 0;
 
-            int128 q = prod / divv;
-            int128 r = prod % divv;
+            uint128 r{};
+            uint128 q = detail::div_pow10_u(detail::abs_u(prod), static_cast<unsigned>(S), r);
 
             if (rnd == Rounding::HalfUp) {
-                uint128 ar = detail::abs_u(r);
-                uint128 ad = detail::abs_u(divv);
-                uint128 two_ar = ar + ar;
-                if (two_ar >= ad) {
-                    q += (prod.high() < 0 ? int128{-1} : int128{1});
-                }
+                if (r + r >= detail::pow10_u(static_cast<unsigned>(S))) q += uint128{0, 1};
             }
 
-            out.init_from_raw(q);
+            out.init_from_raw(detail::apply_sign(q, neg));
             return out;
         }
 
@@ -406,6 +1142,20 @@ namespace usub::umath {
             return out;
         }
 
+        // a * b + c rounded once: the exact product is kept at scale 2S in 256 bits and c is aligned to it, so
+        // the only precision check and division by 10^S happen on the final value.
+        static self fma(const self &a, const self &b, const self &c, Rounding rnd) noexcept {
+            if (!a.ok()) return a;
+            if (!b.ok()) return b;
+            if (!c.ok()) return c;
+
+            const int256 exact = detail::widen_i256(a.raw_) * detail::widen_i256(b.raw_) +
+                                 detail::widen_i256(c.raw_) * int256(detail::pow10_u256(static_cast<unsigned>(S)));
+            self out;
+            out.init_from_wide(detail::round_pow10_i256(exact, static_cast<unsigned>(S), rnd));
+            return out;
+        }
+
         static self add(const self &a, const self &b) noexcept {
             if (!a.ok()) return a;
             if (!b.ok()) return b;
@@ -458,16 +1208,28 @@ namespace usub::umath {
         }
 
     private:
+        template<int, int> friend class Numeric128Column;
+        friend struct detail::numeric_access;
+
         int128 raw_{};
         Err err_{Err::None};
 
+        static parse_batch_result batch_result_(std::span<const self> parsed, std::span<Err> err) noexcept {
+            std::size_t failed = 0;
+            for (std::size_t i = 0; i < parsed.size(); ++i) {
+                failed += !parsed[i].ok();
+                if (i < err.size()) err[i] = parsed[i].err_;
+            }
+            return {parsed.size(), failed};
+        }
+
         void init_error(Err e) noexcept {
             raw_ = int128{0};
             err_ = e;
         }
 
         void init_from_raw(int128 r) noexcept {
-            if (!detail::fits_precision(r, P)) {
+            if (!detail::fits_precision<P>(r)) {
                 init_error(Err::Overflow);
                 return;
             }
@@ -475,6 +1237,15 @@ namespace usub::umath {
             err_ = Err::None;
         }
 
+        void init_from_wide(const int256 &r) noexcept {
+            if (!detail::fits_precision_i256<P>(r)) {
+                init_error(Err::Overflow);
+                return;
+            }
+            raw_ = detail::apply_sign(detail::abs_u256(r).low(), r.is_negative());
+            err_ = Err::None;
+        }
+
         void init_from_int64(std::int64_t v) noexcept {
             int128 r = int128(v) * detail::pow10_i(static_cast<unsigned>(S));
             init_from_raw(r);
@@ -497,83 +1268,56 @@ namespace usub::umath {
                 return;
             }
 
-            uint128 int_part{0, 0};
-            uint128 frac_part{0, 0};
-            unsigned frac_len = 0;
-            bool seen_dot = false;
+            const char *p = s.data();
+            const char *const last = p + s.size();
+            while (p != last && *p == '0') ++p;
 
-            auto is_digit = [](char c) { return c >= '0' && c <= '9'; };
-
-            for (char c: s) {
-                if (c == '.') {
-                    if (seen_dot) {
-                        init_error(Err::Invalid);
-                        return;
-                    }
-                    seen_dot = true;
-                    continue;
-                }
-                if (!is_digit(c)) {
-                    init_error(Err::Invalid);
-                    return;
-                }
+            // Every in-range raw value of a Numeric128<P<=18,S> fits a uint64, so those parse without uint128
+            // multiplies; longer integer parts are only counted, they overflow either way.
+            using mag_t = std::conditional_t<(P <= 18), std::uint64_t, uint128>;
+            mag_t int_part{};
+            const char *q = detail::accumulate_digits(p, last, P <= 18 ? 18 : 38, int_part);
+            q = detail::skip_digits(q, last);
+            const auto int_digits = static_cast<std::size_t>(q - p);
 
-                uint128 d{0, static_cast<std::uint64_t>(c - '0')};
-                if (!seen_dot) {
-                    int_part = int_part * uint128{0, 10} + d;
-                } else {
-                    if (frac_len < 64) {
-                        frac_part = frac_part * uint128{0, 10} + d;
-                        ++frac_len;
-                    } else {
-                        ++frac_len;
-                    }
-                }
+            mag_t frac_part{};
+            unsigned frac_len = 0;
+            unsigned guard = 0;
+            if (q != last && *q == '.') {
+                ++q;
+                const char *f = detail::accumulate_digits(q, last, static_cast<std::size_t>(S), frac_part);
+                frac_len = static_cast<unsigned>(f - q);
+                if (f != last && detail::is_digit(*f)) guard = static_cast<unsigned>(*f - '0');
+                q = detail::skip_digits(f, last);
+            }
+            if (q != last) {
+                init_error(Err::Invalid);
+                return;
+            }
+            if (int_digits > static_cast<std::size_t>(P - S)) {
+                init_error(Err::Overflow);
+                return;
             }
 
-            uint128 raw_mag = int_part * detail::pow10_u(static_cast<unsigned>(S));
-
-            bool round_up = false;
-            if (S == 0) {
-                if (frac_len > 0 && rnd == Rounding::HalfUp) {
-                    if (frac_len <= 64) {
-                        uint128 p = detail::pow10_u(frac_len - 1);
-                        uint128 first = frac_part / p;
-                        round_up = (first.low() >= 5);
-                    } else {
-                        init_error(Err::Invalid);
-                        return;
-                    }
+            if constexpr (P <= 18) {
+                std::uint64_t raw_mag = int_part * detail::pow10_divisors[S].value +
+                                        frac_part * detail::pow10_divisors[static_cast<unsigned>(S) - frac_len].value;
+                if (rnd == Rounding::HalfUp && guard >= 5U) ++raw_mag;
+                if (raw_mag >= detail::pow10_divisors[P].value) {
+                    init_error(Err::Overflow);
+                    return;
                 }
+                const auto r = static_cast<std::int64_t>(raw_mag);
+                raw_ = int128(neg ? -r : r);
+                err_ = Err::None;
             } else {
-                if (frac_len == 0) {
-                } else if (frac_len <= static_cast<unsigned>(S)) {
-                    uint128 mult = detail::pow10_u(static_cast<unsigned>(S) - frac_len);
-                    raw_mag += frac_part * mult;
-                } else {
-                    unsigned cut = frac_len - static_cast<unsigned>(S);
-                    if (frac_len > 64) {
-                        init_error(Err::Invalid);
-                        return;
-                    }
+                uint128 raw_mag = int_part * detail::pow10_u(static_cast<unsigned>(S)) +
+                                  frac_part * detail::pow10_u(static_cast<unsigned>(S) - frac_len);
+                if (rnd == Rounding::HalfUp && guard >= 5U) raw_mag += uint128{0, 1};
 
-                    uint128 divv = detail::pow10_u(cut);
-                    uint128 q{};
-                    uint128 r{};
-                    q = detail::div_u(frac_part, divv, r);
-
-                    if (rnd == Rounding::HalfUp) {
-                        uint128 two_r = r + r;
-                        round_up = (two_r >= divv);
-                    }
-                    raw_mag += q;
-                }
+                int128 raw_signed = detail::apply_sign(raw_mag, neg);
+                init_from_raw(raw_signed);
             }
-
-            if (round_up) raw_mag += uint128{0, 1};
-
-            int128 raw_signed = detail::apply_sign(raw_mag, neg);
-            init_from_raw(raw_signed);
         }
 
         template<std::integral I>
@@ -684,40 +1428,53 @@ namespace usub::umath {
 
         [[nodiscard]] int256 raw() const noexcept { return raw_; }
 
-        [[nodiscard]] std::string to_string() const {
-            if (!ok()) return "<err>";
+        static constexpr std::size_t max_chars =
+                1 + static_cast<std::size_t>(P - S > 0 ? P - S : 1) + (S > 0 ? 1 + static_cast<std::size_t>(S) : 0);
+
+        std::to_chars_result to_chars(char *first, char *last) const noexcept {
+            if (!ok()) return {first, std::errc::invalid_argument};
 
             const bool neg = raw_.is_negative();
-            const uint256 mag = detail::abs_u256(raw_);
+            uint256 frac_mag{};
+            const uint256 int_mag =
+                    detail::div_pow10_u256(detail::abs_u256(raw_), static_cast<unsigned>(S), frac_mag);
 
-            if (mag == uint256{0U}) {
-                if constexpr (S == 0) return "0";
-                std::string z = "0.";
-                z.append(static_cast<std::size_t>(S), '0');
-                return z;
+            char buf[max_chars];
+            char *p = buf + max_chars;
+            if constexpr (S > 0) {
+                std::uint64_t fw[4] = {
+                    frac_mag.low().low(), frac_mag.low().high(), frac_mag.high().low(), frac_mag.high().high()
+                };
+                p = detail::write_fixed_backward(p, fw, S);
+                *--p = '.';
             }
+            std::uint64_t iw[4] = {
+                int_mag.low().low(), int_mag.low().high(), int_mag.high().low(), int_mag.high().high()
+            };
+            p = detail::write_limbs_backward(p, iw);
+            if (neg) *--p = '-';
 
-            const uint256 div = detail::pow10_u256(static_cast<unsigned>(S));
-            const uint256 int_mag = mag / div;
-            const uint256 frac_mag = mag % div;
+            return detail::copy_chars(first, last, p, buf + max_chars);
+        }
 
-            std::string is = int_mag.to_string();
-            if constexpr (S == 0) {
-                return neg ? ("-" + is) : is;
-            }
+        friend std::from_chars_result from_chars(const char *first, const char *last, self &value,
+                                                 Rounding rnd = Rounding::HalfUp) noexcept {
+            const char *end = detail::scan_decimal(first, last);
+            if (end == first) return {first, std::errc::invalid_argument};
 
-            std::string fs = frac_mag.to_string();
-            if (fs.size() < static_cast<std::size_t>(S)) {
-                fs.insert(fs.begin(), static_cast<std::size_t>(S) - fs.size(), '0');
-            }
+            self tmp;
+            tmp.init_parse(std::string_view(first, static_cast<std::size_t>(end - first)), rnd);
+            if (!tmp.ok()) return {end, detail::to_errc(tmp.err_)};
+            value = tmp;
+            return {end, std::errc{}};
+        }
 
-            std::string out;
-            out.reserve(is.size() + 1 + fs.size() + (neg ? 1U : 0U));
-            if (neg) out.push_back('-');
-            out += is;
-            out.push_back('.');
-            out += fs;
-            return out;
+        [[nodiscard]] std::string to_string() const {
+            if (!ok()) return "<err>";
+
+            char buf[max_chars];
+            const auto res = to_chars(buf, buf + max_chars);
+            return {buf, res.ptr};
         }
 
         friend inline std::ostream &operator<<(std::ostream &os, const self &v) {
@@ -892,7 +1649,7 @@ namespace usub::umath {
             const uint256 divv = detail::pow10_u256(static_cast<unsigned>(S));
 
             uint256 r{};
-            uint256 q = detail::div_u256(prod, divv, r);
+            uint256 q = detail::div_pow10_u256(prod, static_cast<unsigned>(S), r);
 
             if (rnd == Rounding::HalfUp) {
                 const uint256 two_r = r + r;
@@ -982,6 +1739,8 @@ namespace usub::umath {
         operator long double() const noexcept { return to_long_double(); }
 
     private:
+        friend struct detail::numeric_access;
+
         int256 raw_{};
         Err err_{Err::None};
 
@@ -991,7 +1750,7 @@ namespace usub::umath {
         }
 
         void init_from_raw(int256 r) noexcept {
-            if (!detail::fits_precision_i256(r, P)) {
+            if (!detail::fits_precision_i256<P>(r)) {
                 init_error(Err::Overflow);
                 return;
             }
@@ -1043,8 +1802,6 @@ namespace usub::umath {
             bool seen_dot = false;
             bool any = false;
 
-            auto is_digit = [](char c) { return c >= '0' && c <= '9'; };
-
             for (char c: s) {
                 if (c == '.') {
                     if (seen_dot) {
@@ -1054,7 +1811,7 @@ namespace usub::umath {
                     seen_dot = true;
                     continue;
                 }
-                if (!is_digit(c)) {
+                if (!detail::is_digit(c)) {
                     init_error(Err::Invalid);
                     return;
                 }
@@ -1136,7 +1893,7 @@ namespace usub::umath {
                     }
 
                     uint256 rem{};
-                    uint256 q = detail::div_u256(frac_keep, uint256{10U}, rem);
+                    uint256 q = detail::div_pow10_u256(frac_keep, 1U, rem);
 
                     if (rnd == Rounding::HalfUp) {
                         const auto guard64 = static_cast<std::uint64_t>(rem);
@@ -1237,6 +1994,18 @@ namespace usub::umath {
         explicit Numeric(std::int64_t v) noexcept { init_from_int64(v); }
         explicit Numeric(std::string_view s, Rounding rnd = Rounding::HalfUp) noexcept { init_parse(s, rnd); }
 
+        // Values built on a memory resource keep their limbs there, and results of add/sub/mul/div (with their
+        // intermediates) are allocated from the left operand's resource. Copies inherit the resource;
+        // assignment keeps the target's.
+        Numeric(std::int64_t v, std::pmr::memory_resource *mr) noexcept : mag_(mr) { init_from_int64(v); }
+
+        Numeric(std::string_view s, std::pmr::memory_resource *mr, Rounding rnd = Rounding::HalfUp) noexcept
+            : mag_(mr) {
+            init_parse(s, rnd);
+        }
+
+        [[nodiscard]] std::pmr::memory_resource *resource() const noexcept { return mag_.resource(); }
+
         [[nodiscard]] bool ok() const noexcept { return err_ == Err::None; }
         [[nodiscard]] Err error() const noexcept { return err_; }
         explicit operator bool() const noexcept { return ok(); }
@@ -1258,34 +2027,59 @@ namespace usub::umath {
             return out;
         }
 
-        [[nodiscard]] std::string to_string() const {
-            if (!ok()) return "<err>";
-            if (is_zero_()) return "0";
+        static constexpr std::size_t max_chars =
+                3 + static_cast<std::size_t>(max_int_digits) + static_cast<std::size_t>(max_frac_digits);
 
-            std::string digits = mag_to_decimal_();
+        std::to_chars_result to_chars(char *first, char *last) const noexcept {
+            if (!ok()) return {first, std::errc::invalid_argument};
 
-            if (scale_ == 0) {
-                if (neg_) digits.insert(digits.begin(), '-');
-                return digits;
-            }
+            const std::size_t len = chars_needed_();
+            if (static_cast<std::size_t>(last - first) < len) return {last, std::errc::value_too_large};
 
-            if (static_cast<int>(digits.size()) <= scale_) {
-                std::string res;
-                res.reserve((neg_ ? 1U : 0U) + 2U + static_cast<std::size_t>(scale_) - digits.size() + digits.size());
-                if (neg_) res.push_back('-');
-                res += "0.";
-                res.append(static_cast<std::size_t>(scale_ - static_cast<int>(digits.size())), '0');
-                res += digits;
-                return res;
+            char *p = first + len;
+            if (is_zero_()) {
+                *--p = '0';
+                return {first + len, std::errc{}};
+            }
+
+            int written = 0;
+            auto put = [&](char c) {
+                *--p = c;
+                if (++written == scale_) *--p = '.';
+            };
+
+            for (std::size_t i = 0; i < mag_.size(); ++i) {
+                std::uint32_t v = mag_[i];
+                const int nd = (i + 1 == mag_.size()) ? dec_digits_u32_(v) : base_digits;
+                for (int k = 0; k < nd; ++k) {
+                    put(static_cast<char>('0' + v % 10U));
+                    v /= 10U;
+                }
             }
+            while (written < scale_) put('0');
+            if (*p == '.') *--p = '0';
+            if (neg_) *--p = '-';
+
+            return {first + len, std::errc{}};
+        }
+
+        friend std::from_chars_result from_chars(const char *first, const char *last, self &value,
+                                                 Rounding rnd = Rounding::HalfUp) {
+            const char *end = detail::scan_decimal(first, last);
+            if (end == first) return {first, std::errc::invalid_argument};
 
-            const std::size_t p = digits.size() - static_cast<std::size_t>(scale_);
-            std::string res;
-            res.reserve((neg_ ? 1U : 0U) + digits.size() + 1U);
-            if (neg_) res.push_back('-');
-            res.append(digits.begin(), digits.begin() + static_cast<std::ptrdiff_t>(p));
-            res.push_back('.');
-            res.append(digits.begin() + static_cast<std::ptrdiff_t>(p), digits.end());
+            self tmp;
+            tmp.init_parse(std::string_view(first, static_cast<std::size_t>(end - first)), rnd);
+            if (!tmp.ok()) return {end, detail::to_errc(tmp.err_)};
+            value = std::move(tmp);
+            return {end, std::errc{}};
+        }
+
+        [[nodiscard]] std::string to_string() const {
+            if (!ok()) return "<err>";
+
+            std::string res(chars_needed_(), '\0');
+            to_chars(res.data(), res.data() + res.size());
             return res;
         }
 
@@ -1310,19 +2104,11 @@ namespace usub::umath {
             return div(a, b, std::max(a.scale_, b.scale_), Rounding::HalfUp);
         }
 
-        self &operator+=(const self &b) noexcept {
-            *this = *this + b;
-            return *this;
-        }
-
-        self &operator-=(const self &b) noexcept {
-            *this = *this - b;
-            return *this;
-        }
+        self &operator+=(const self &b) noexcept { return add_assign(b); }
+        self &operator-=(const self &b) noexcept { return sub_assign(b); }
 
         self &operator*=(const self &b) noexcept {
-            *this = *this * b;
-            return *this;
+            return mul_assign(b, std::max(scale_, b.scale_), Rounding::HalfUp);
         }
 
         self &operator/=(const self &b) noexcept {
@@ -1380,60 +2166,60 @@ namespace usub::umath {
 
         static self add(const self &a, const self &b) noexcept {
             if (!a.ok()) return a;
-            if (!b.ok()) return b;
-
-            self x = a;
-            self y = b;
-
-            const int res_scale = std::max(x.scale_, y.scale_);
-            if (!x.rescale_up_(res_scale) || !y.rescale_up_(res_scale)) {
-                self out;
-                out.set_error_(Err::Overflow);
-                return out;
-            }
+            self out = a;
+            out.add_assign(b);
+            return out;
+        }
 
-            self out;
-            out.scale_ = res_scale;
+        static self sub(const self &a, const self &b) noexcept {
+            if (!a.ok()) return a;
+            self out = a;
+            out.sub_assign(b);
+            return out;
+        }
 
-            if (x.is_zero_()) return y;
-            if (y.is_zero_()) return x;
+        // In-place counterparts of add/sub/mul: they reuse this value's limbs and rescale only the operand with
+        // the smaller scale.
+        self &add_assign(const self &b) noexcept { return add_signed_(b, b.neg_); }
+        self &sub_assign(const self &b) noexcept { return add_signed_(b, !b.neg_); }
 
-            if (x.neg_ == y.neg_) {
-                out.mag_ = add_abs_(x.mag_, y.mag_);
-                out.neg_ = x.neg_;
-            } else {
-                const int c = cmp_abs_(x.mag_, y.mag_);
-                if (c == 0) {
-                    out.mag_.clear();
-                    out.neg_ = false;
-                    out.scale_ = 0;
-                } else if (c > 0) {
-                    out.mag_ = sub_abs_(x.mag_, y.mag_);
-                    out.neg_ = x.neg_;
-                } else {
-                    out.mag_ = sub_abs_(y.mag_, x.mag_);
-                    out.neg_ = y.neg_;
-                }
+        self &mul_assign(const self &b, int target_scale, Rounding rnd) noexcept {
+            if (!ok()) return *this;
+            if (!b.ok()) {
+                set_error_(b.err_);
+                return *this;
+            }
+            if (target_scale < 0 || target_scale > max_frac_digits) {
+                set_error_(Err::Overflow);
+                return *this;
+            }
+            if (is_zero_() || b.is_zero_()) {
+                mag_.clear();
+                neg_ = false;
+                scale_ = 0;
+                return *this;
             }
 
-            out.normalize_();
-            if (!out.check_limits_()) out.set_error_(Err::Overflow);
-            return out;
-        }
+            mul_abs_in_(mag_, b.mag_);
+            neg_ = neg_ != b.neg_;
+            scale_ += b.scale_;
+            normalize_();
 
-        static self sub(const self &a, const self &b) noexcept {
-            if (!a.ok()) return a;
-            if (!b.ok()) return b;
-            self nb = b;
-            if (!nb.is_zero_()) nb.neg_ = !nb.neg_;
-            return add(a, nb);
+            if (!rescale_(target_scale, rnd) || !check_limits_()) set_error_(Err::Overflow);
+            return *this;
         }
 
-        static self mul(const self &a, const self &b, int target_scale, Rounding rnd) noexcept {
+        // With threads > 1, multiplying or dividing operands of thousands of limbs spreads the NTT transforms and
+        // subproducts over up to that many threads of a shared pool. The result is identical to the serial one and
+        // comes from a's resource. Scratch space of the parallel parts comes from worker_mr instead: several threads
+        // use it at once, so it must be thread-safe (new_delete_resource, the default, or a
+        // std::pmr::synchronized_pool_resource). A single-threaded arena belongs in a, not here.
+        static self mul(const self &a, const self &b, int target_scale, Rounding rnd, unsigned threads = 1,
+                        std::pmr::memory_resource *worker_mr = std::pmr::new_delete_resource()) noexcept {
             if (!a.ok()) return a;
             if (!b.ok()) return b;
 
-            self out;
+            self out(0, a.resource());
             if (target_scale < 0 || target_scale > max_frac_digits) {
                 out.set_error_(Err::Overflow);
                 return out;
@@ -1447,7 +2233,7 @@ namespace usub::umath {
                 return out;
             }
 
-            std::vector<std::uint32_t> prod = mul_abs_(a.mag_, b.mag_);
+            mag_t prod = mul_abs_(a.mag_, b.mag_, threads, worker_mr);
             int prod_scale = a.scale_ + b.scale_;
             bool neg = a.neg_ ^ b.neg_;
 
@@ -1466,11 +2252,13 @@ namespace usub::umath {
             return out;
         }
 
-        static self div(const self &a, const self &b, int target_scale, Rounding rnd) noexcept {
+        // threads and worker_mr as for mul.
+        static self div(const self &a, const self &b, int target_scale, Rounding rnd, unsigned threads = 1,
+                        std::pmr::memory_resource *worker_mr = std::pmr::new_delete_resource()) noexcept {
             if (!a.ok()) return a;
             if (!b.ok()) return b;
 
-            self out;
+            self out(0, a.resource());
             if (target_scale < 0 || target_scale > max_frac_digits) {
                 out.set_error_(Err::Overflow);
                 return out;
@@ -1490,8 +2278,8 @@ namespace usub::umath {
             const int extra = (rnd == Rounding::HalfUp) ? 1 : 0;
             const int k = target_scale + extra + b.scale_ - a.scale_;
 
-            std::vector<std::uint32_t> num = a.mag_;
-            std::vector<std::uint32_t> den = b.mag_;
+            mag_t num = a.mag_;
+            mag_t den(b.mag_.begin(), b.mag_.end(), a.resource());
 
             if (k >= 0) {
                 if (!mul_pow10_(num, k)) {
@@ -1505,7 +2293,7 @@ namespace usub::umath {
                 }
             }
 
-            auto qr = div_mod_abs_(num, den);
+            auto qr = div_mod_abs_(std::move(num), std::move(den), threads, worker_mr);
             out.mag_ = std::move(qr.first);
             out.neg_ = a.neg_ ^ b.neg_;
             out.scale_ = target_scale + extra;
@@ -1588,10 +2376,17 @@ namespace usub::umath {
         }
 
     private:
+        friend struct detail::numeric_access;
+
         static constexpr std::uint32_t base = 1'000'000'000U;
         static constexpr int base_digits = 9;
 
-        std::vector<std::uint32_t> mag_{};
+        // Limbs kept inline before a magnitude spills to the heap: 6 limbs cover 54 digits, so typical values
+        // and the sums and rescales built from them never allocate.
+        static constexpr std::size_t inline_limbs = 6;
+        using mag_t = detail::small_limbs<inline_limbs>;
+
+        mag_t mag_{};
         int scale_ = 0;
         bool neg_ = false;
         Err err_ = Err::None;
@@ -1633,6 +2428,14 @@ namespace usub::umath {
             return (static_cast<int>(mag_.size()) - 1) * base_digits + dec_digits_u32_(mag_.back());
         }
 
+        [[nodiscard]] std::size_t chars_needed_() const noexcept {
+            if (is_zero_()) return 1;
+            const auto digs = static_cast<std::size_t>(decimal_digits_());
+            const auto sc = static_cast<std::size_t>(scale_);
+            const std::size_t body = (sc == 0) ? digs : (digs <= sc ? 2 + sc : digs + 1);
+            return (neg_ ? 1U : 0U) + body;
+        }
+
         [[nodiscard]] bool check_limits_() const noexcept {
             if (scale_ < 0 || scale_ > max_frac_digits) return false;
             if (mag_.empty()) return true;
@@ -1641,13 +2444,15 @@ namespace usub::umath {
             return before <= max_int_digits;
         }
 
+        static constexpr std::uint32_t pow10_u32_table_[base_digits + 1] = {
+            1U, 10U, 100U, 1000U, 10000U, 100000U, 1000000U, 10000000U, 100000000U, 1000000000U
+        };
+
         static std::uint32_t pow10_u32_(int k) noexcept {
-            std::uint32_t p = 1U;
-            for (int i = 0; i < k; ++i) p *= 10U;
-            return p;
+            return pow10_u32_table_[k];
         }
 
-        static void add_one_(std::vector<std::uint32_t> &v) {
+        static void add_one_(mag_t &v) {
             std::uint64_t carry = 1;
             for (unsigned int &i: v) {
                 const std::uint64_t cur = static_cast<std::uint64_t>(i) + carry;
@@ -1658,7 +2463,7 @@ namespace usub::umath {
             if (carry != 0) v.push_back(static_cast<std::uint32_t>(carry));
         }
 
-        static int cmp_abs_(const std::vector<std::uint32_t> &a, const std::vector<std::uint32_t> &b) noexcept {
+        static int cmp_abs_(const mag_t &a, const mag_t &b) noexcept {
             if (a.size() != b.size()) return (a.size() < b.size()) ? -1 : 1;
             for (std::size_t i = a.size(); i-- > 0;) {
                 if (a[i] != b[i]) return (a[i] < b[i]) ? -1 : 1;
@@ -1666,10 +2471,9 @@ namespace usub::umath {
             return 0;
         }
 
-        static std::vector<std::uint32_t> add_abs_(const std::vector<std::uint32_t> &a,
-                                                   const std::vector<std::uint32_t> &b) {
+        static mag_t add_abs_(const mag_t &a, const mag_t &b) {
             const std::size_t n = std::max(a.size(), b.size());
-            std::vector<std::uint32_t> r;
+            mag_t r(a.resource());
             r.resize(n);
 
             std::uint64_t carry = 0;
@@ -1685,9 +2489,39 @@ namespace usub::umath {
             return r;
         }
 
-        static std::vector<std::uint32_t> sub_abs_(const std::vector<std::uint32_t> &a,
-                                                   const std::vector<std::uint32_t> &b) {
-            std::vector<std::uint32_t> r = a;
+        // r += b.
+        static void add_abs_in_(mag_t &r, const mag_t &b) {
+            if (r.size() < b.size()) r.resize(b.size());
+            std::uint32_t carry = 0;
+            std::size_t i = 0;
+            for (; i < b.size(); ++i) {
+                const std::uint32_t s = r[i] + b[i] + carry;
+                carry = s >= base;
+                r[i] = carry ? s - base : s;
+            }
+            for (; carry != 0 && i < r.size(); ++i) {
+                const std::uint32_t s = r[i] + 1U;
+                carry = s >= base;
+                r[i] = carry ? 0U : s;
+            }
+            if (carry != 0) r.push_back(1U);
+        }
+
+        // r = b - r; b must not be smaller than r.
+        static void rsub_abs_in_(mag_t &r, const mag_t &b) {
+            const std::size_t n = r.size();
+            r.resize(b.size());
+            std::uint32_t borrow = 0;
+            for (std::size_t i = 0; i < b.size(); ++i) {
+                const std::uint32_t d = (i < n ? r[i] : 0U) + borrow;
+                borrow = b[i] < d;
+                r[i] = borrow ? b[i] + base - d : b[i] - d;
+            }
+            trim_(r);
+        }
+
+        static mag_t sub_abs_(const mag_t &a, const mag_t &b) {
+            mag_t r = a;
             std::int64_t carry = 0;
             for (std::size_t i = 0; i < r.size(); ++i) {
                 const auto av = static_cast<std::int64_t>(r[i]);
@@ -1705,31 +2539,346 @@ namespace usub::umath {
             return r;
         }
 
-        static std::vector<std::uint32_t> mul_abs_(const std::vector<std::uint32_t> &a,
-                                                   const std::vector<std::uint32_t> &b) {
-            if (a.empty() || b.empty()) return {};
-            std::vector<std::uint64_t> tmp;
-            tmp.assign(a.size() + b.size(), 0ULL);
+        // Limb counts (of the shorter operand) at which mul_abs_ moves from the basecase to Karatsuba, Toom-3
+        // and finally the three-prime NTT.
+        static constexpr std::size_t karatsuba_threshold_ = 64;
+        static constexpr std::size_t toom3_threshold_ = 240;
+        static constexpr std::size_t ntt_threshold_ = 1000;
+
+        // r[0, na + nb) = a * b. Products are accumulated in 64 bits and only normalized every
+        // lazy_rows_ rows: 16 * (base - 1)^2 plus a pending carry still fits in a uint64_t.
+        static constexpr std::size_t lazy_rows_ = 16;
+
+#if defined(__SIZEOF_INT128__)
+        // Pairs of limbs packed into base-1e18 digits, multiplied with 128-bit column sums: a quarter of the limb
+        // products of the 32-bit basecase. A column adds at most wide_terms_ products below 10^36, which with the
+        // incoming carry stays below 2^128.
+        static constexpr std::size_t wide_terms_ = 256;
+        static constexpr std::size_t wide_min_limbs_ = 6;
+
+        static void mul_basecase_wide_(const std::uint32_t *a, std::size_t na, const std::uint32_t *b,
+                                       std::size_t nb, std::uint32_t *r, std::pmr::memory_resource *mr) {
+            using u128 = unsigned __int128;
+            if (na < nb) {
+                std::swap(a, b);
+                std::swap(na, nb);
+            }
+            const std::size_t wa = (na + 1) / 2;
+            const std::size_t wb = (nb + 1) / 2;
+            const std::size_t n = na + nb;
+
+            std::uint64_t small[2 * karatsuba_threshold_];
+            std::pmr::vector<std::uint64_t> big(mr);
+            std::uint64_t *pa = small;
+            if (wa + wb > std::size(small)) {
+                big.resize(wa + wb);
+                pa = big.data();
+            }
+            std::uint64_t *pb = pa + wa;
+            auto pack = [](const std::uint32_t *x, std::size_t nx, std::uint64_t *out) {
+                for (std::size_t i = 0; i < nx / 2; ++i) out[i] = x[2 * i] + std::uint64_t{x[2 * i + 1]} * base;
+                if (nx % 2 != 0) out[nx / 2] = x[nx - 1];
+            };
+            pack(a, na, pa);
+            pack(b, nb, pb);
+
+            u128 carry = 0;
+            for (std::size_t k = 0; 2 * k < n; ++k) {
+                u128 sum = carry;
+                const std::size_t j1 = std::min(k + 1, wb);
+                for (std::size_t j = k >= wa ? k - wa + 1 : 0; j < j1; ++j) sum += static_cast<u128>(pa[k - j]) * pb[j];
+
+                std::uint64_t w[2] = {static_cast<std::uint64_t>(sum), static_cast<std::uint64_t>(sum >> 64)};
+                const std::uint64_t digit = detail::divrem_pow10_limbs(w, 18);
+                carry = static_cast<u128>(w[1]) << 64 | w[0];
+                r[2 * k] = static_cast<std::uint32_t>(digit % base);
+                if (2 * k + 1 < n) r[2 * k + 1] = static_cast<std::uint32_t>(digit / base);
+            }
+        }
+#endif
+
+        static void mul_basecase_(const std::uint32_t *a, std::size_t na, const std::uint32_t *b, std::size_t nb,
+                                  std::uint32_t *r, std::pmr::memory_resource *mr) {
+#if defined(__SIZEOF_INT128__)
+            if (const std::size_t m = std::min(na, nb); m >= wide_min_limbs_ && m <= 2 * wide_terms_) {
+                mul_basecase_wide_(a, na, b, nb, r, mr);
+                return;
+            }
+#endif
+            std::uint64_t small[4 * karatsuba_threshold_];
+            std::pmr::vector<std::uint64_t> big(mr);
+            std::uint64_t *acc = small;
+            if (na + nb > std::size(small)) {
+                big.resize(na + nb);
+                acc = big.data();
+            }
+            std::fill(acc, acc + na + nb, 0ULL);
+
+            for (std::size_t i0 = 0; i0 < na; i0 += lazy_rows_) {
+                const std::size_t i1 = std::min(na, i0 + lazy_rows_);
+                for (std::size_t i = i0; i < i1; ++i) {
+                    const std::uint64_t ai = a[i];
+                    std::uint64_t *row = acc + i;
+                    for (std::size_t j = 0; j < nb; ++j) row[j] += ai * b[j];
+                }
 
-            for (std::size_t i = 0; i < a.size(); ++i) {
                 std::uint64_t carry = 0;
-                for (std::size_t j = 0; j < b.size(); ++j) {
-                    const std::uint64_t cur =
-                            tmp[i + j] + static_cast<std::uint64_t>(a[i]) * static_cast<std::uint64_t>(b[j]) + carry;
-                    tmp[i + j] = cur % base;
+                const std::size_t top = i1 + nb - 1;
+                for (std::size_t t = i0; t < top; ++t) {
+                    const std::uint64_t cur = acc[t] + carry;
+                    acc[t] = cur % base;
                     carry = cur / base;
                 }
-                tmp[i + b.size()] += carry;
+                acc[top] += carry;
+            }
+
+            for (std::size_t t = 0; t < na + nb; ++t) r[t] = static_cast<std::uint32_t>(acc[t]);
+        }
+
+        // r[0, n) += a[0, na), carrying into the remaining limbs of r; the sum must fit in n limbs.
+        static void add_into_(std::uint32_t *r, std::size_t n, const std::uint32_t *a, std::size_t na) noexcept {
+            std::uint32_t carry = 0;
+            std::size_t i = 0;
+            for (; i < na; ++i) {
+                const std::uint32_t s = r[i] + a[i] + carry;
+                carry = s >= base;
+                r[i] = carry ? s - base : s;
+            }
+            for (; carry != 0 && i < n; ++i) {
+                const std::uint32_t s = r[i] + 1U;
+                carry = s >= base;
+                r[i] = carry ? 0U : s;
+            }
+        }
+
+        // r[0, n) -= a[0, na); r must not be smaller than a.
+        static void sub_from_(std::uint32_t *r, std::size_t n, const std::uint32_t *a, std::size_t na) noexcept {
+            std::uint32_t borrow = 0;
+            std::size_t i = 0;
+            for (; i < na; ++i) {
+                const std::uint32_t d = a[i] + borrow;
+                borrow = r[i] < d;
+                r[i] = borrow ? r[i] + base - d : r[i] - d;
+            }
+            for (; borrow != 0 && i < n; ++i) {
+                borrow = r[i] == 0U;
+                r[i] = borrow ? base - 1U : r[i] - 1U;
+            }
+        }
+
+        static std::size_t karatsuba_scratch_(std::size_t n) noexcept {
+            std::size_t total = 0;
+            while (n >= karatsuba_threshold_) {
+                const std::size_t hh = n - n / 2 + 1;
+                total += 4 * hh;
+                n = hh;
+            }
+            return total;
+        }
+
+        // r[0, 2n) = a[0, n) * b[0, n).
+        static void mul_karatsuba_(const std::uint32_t *a, const std::uint32_t *b, std::size_t n,
+                                   std::uint32_t *r, std::uint32_t *scratch, std::pmr::memory_resource *mr) {
+            if (n < karatsuba_threshold_) {
+                mul_basecase_(a, n, b, n, r, mr);
+                return;
+            }
+
+            const std::size_t h = n / 2;
+            const std::size_t hh = n - h;
+            const std::size_t m = hh + 1;
+
+            std::uint32_t *sa = scratch;
+            std::uint32_t *sb = sa + m;
+            std::uint32_t *z1 = sb + m;
+            std::uint32_t *next = z1 + 2 * m;
+
+            std::copy(a + h, a + n, sa);
+            sa[hh] = 0U;
+            add_into_(sa, m, a, h);
+            std::copy(b + h, b + n, sb);
+            sb[hh] = 0U;
+            add_into_(sb, m, b, h);
+
+            mul_karatsuba_(a, b, h, r, next, mr);
+            mul_karatsuba_(a + h, b + h, hh, r + 2 * h, next, mr);
+            mul_karatsuba_(sa, sb, m, z1, next, mr);
+
+            sub_from_(z1, 2 * m, r, 2 * h);
+            sub_from_(z1, 2 * m, r + 2 * h, 2 * hh);
+
+            std::size_t z1n = 2 * m;
+            while (z1n != 0 && z1[z1n - 1] == 0U) --z1n;
+            add_into_(r + h, 2 * n - h, z1, z1n);
+        }
+
+        struct signed_mag_ {
+            mag_t mag;
+            bool neg = false;
+        };
+
+        static signed_mag_ signed_add_(const signed_mag_ &a, const signed_mag_ &b) {
+            if (a.neg == b.neg) return {add_abs_(a.mag, b.mag), a.neg};
+            const int c = cmp_abs_(a.mag, b.mag);
+            if (c == 0) return {mag_t(a.mag.resource())};
+            if (c > 0) return {sub_abs_(a.mag, b.mag), a.neg};
+            return {sub_abs_(b.mag, a.mag), b.neg};
+        }
+
+        static signed_mag_ signed_sub_(const signed_mag_ &a, signed_mag_ b) {
+            b.neg = !b.neg;
+            return signed_add_(a, b);
+        }
+
+        static signed_mag_ signed_mul_(const signed_mag_ &a, const signed_mag_ &b) {
+            signed_mag_ r{mul_abs_(a.mag, b.mag), a.neg != b.neg};
+            if (r.mag.empty()) r.neg = false;
+            return r;
+        }
+
+        static void signed_div_exact_(signed_mag_ &v, std::uint32_t d) {
+            std::uint32_t rem = 0;
+            div_small_(v.mag, d, rem);
+            if (v.mag.empty()) v.neg = false;
+        }
+
+        static mag_t trimmed_(const std::uint32_t *p, std::size_t n, std::pmr::memory_resource *mr) {
+            while (n != 0 && p[n - 1] == 0U) --n;
+            return {p, p + n, mr};
+        }
+
+        // r[0, 2n) = a[0, n) * b[0, n), evaluating at 0, 1, -1, -2 and infinity (Bodrato's sequence).
+        static void mul_toom3_(const std::uint32_t *a, const std::uint32_t *b, std::size_t n, std::uint32_t *r,
+                               std::pmr::memory_resource *mr) {
+            const std::size_t k = (n + 2) / 3;
+
+            // Built by construction rather than assignment so every value stays on mr.
+            auto evaluate = [&](const std::uint32_t *x) {
+                const signed_mag_ x0{trimmed_(x, k, mr)};
+                const signed_mag_ x1{trimmed_(x + k, k, mr)};
+                const signed_mag_ x2{trimmed_(x + 2 * k, n - 2 * k, mr)};
+                const signed_mag_ x02 = signed_add_(x0, x2);
+                signed_mag_ xm1 = signed_sub_(x02, x1);
+                signed_mag_ xm2 = signed_add_(xm1, x2);
+                mul_small_(xm2.mag, 2U);
+                return std::array<signed_mag_, 5>{
+                    x0, signed_add_(x02, x1), std::move(xm1), signed_sub_(xm2, x0), x2
+                };
+            };
+
+            const std::array<signed_mag_, 5> ea = evaluate(a);
+            const std::array<signed_mag_, 5> eb = evaluate(b);
+
+            const signed_mag_ r0 = signed_mul_(ea[0], eb[0]);
+            const signed_mag_ r_1 = signed_mul_(ea[1], eb[1]);
+            const signed_mag_ r_m1 = signed_mul_(ea[2], eb[2]);
+            const signed_mag_ r_m2 = signed_mul_(ea[3], eb[3]);
+            const signed_mag_ r4 = signed_mul_(ea[4], eb[4]);
+
+            signed_mag_ r3 = signed_sub_(r_m2, r_1);
+            signed_div_exact_(r3, 3U);
+            signed_mag_ r1 = signed_sub_(r_1, r_m1);
+            signed_div_exact_(r1, 2U);
+            signed_mag_ r2 = signed_sub_(r_m1, r0);
+            r3 = signed_sub_(r2, r3);
+            signed_div_exact_(r3, 2U);
+            signed_mag_ twice_r4 = r4;
+            mul_small_(twice_r4.mag, 2U);
+            r3 = signed_add_(r3, twice_r4);
+            r2 = signed_sub_(signed_add_(r2, r1), r4);
+            r1 = signed_sub_(r1, r3);
+
+            std::fill(r, r + 2 * n, 0U);
+            const signed_mag_ *coef[5] = {&r0, &r1, &r2, &r3, &r4};
+            for (std::size_t i = 0; i < 5; ++i) {
+                const auto &c = coef[i]->mag;
+                if (!c.empty()) add_into_(r + i * k, 2 * n - i * k, c.data(), c.size());
+            }
+        }
+
+        // r[0, 2n) = a[0, n) * b[0, n).
+        static void mul_equal_(const std::uint32_t *a, const std::uint32_t *b, std::size_t n, std::uint32_t *r,
+                               std::pmr::memory_resource *mr) {
+            if (n < karatsuba_threshold_) {
+                mul_basecase_(a, n, b, n, r, mr);
+            } else if (n < toom3_threshold_) {
+                mag_t scratch(karatsuba_scratch_(n), 0U, mr);
+                mul_karatsuba_(a, b, n, r, scratch.data(), mr);
+            } else {
+                mul_toom3_(a, b, n, r, mr);
+            }
+        }
+
+        // Longer operand length (in limbs) from which mul_abs_ spreads the work over its thread budget.
+        static constexpr std::size_t parallel_min_limbs_ = 2000;
+
+        // The product and all serial scratch space come from a's memory resource; with threads > 1, scratch of the
+        // parallel parts comes from worker_mr, which must be thread-safe. The result does not depend on threads.
+        static mag_t mul_abs_(const mag_t &a, const mag_t &b, unsigned threads = 1,
+                              std::pmr::memory_resource *worker_mr = std::pmr::new_delete_resource()) {
+            std::pmr::memory_resource *mr = a.resource();
+            if (a.empty() || b.empty()) return mag_t(mr);
+            const mag_t &x = a.size() >= b.size() ? a : b;
+            const mag_t &y = a.size() >= b.size() ? b : a;
+            const std::size_t nx = x.size();
+            const std::size_t ny = y.size();
+
+            if (nx < parallel_min_limbs_) threads = 1;
+            mag_t r(nx + ny, 0U, mr);
+            if (ny >= ntt_threshold_) {
+                detail::mul_ntt_base1e9(x.data(), nx, y.data(), ny, r.data(), mr, threads, worker_mr);
+            } else if (ny < karatsuba_threshold_) {
+                mul_basecase_(x.data(), nx, y.data(), ny, r.data(), mr);
+            } else {
+                // Multiply ny-limb slices of x by y and accumulate, so unbalanced operands stay sub-quadratic.
+                mag_t part(2 * ny, 0U, mr);
+                std::size_t off = 0;
+                const std::size_t slices = nx / ny;
+                if (threads > 1 && slices > 1) {
+                    // Each worker sums a run of consecutive slices into its own buffer; the runs are then added
+                    // into r in order.
+                    const std::size_t w = std::min<std::size_t>(threads, slices);
+                    std::pmr::memory_resource *tmr = worker_mr;
+                    std::vector<mag_t> runs;
+                    runs.reserve(w);
+                    for (std::size_t j = 0; j < w; ++j) runs.emplace_back(tmr);
+                    detail::parallel_for(w, static_cast<unsigned>(w), [&](std::size_t j) {
+                        const std::size_t s0 = slices * j / w, s1 = slices * (j + 1) / w;
+                        mag_t &run = runs[j];
+                        run.resize((s1 - s0 + 1) * ny, 0U);
+                        mag_t tmp(2 * ny, 0U, tmr);
+                        for (std::size_t s = s0; s < s1; ++s) {
+                            mul_equal_(x.data() + s * ny, y.data(), ny, tmp.data(), tmr);
+                            add_into_(run.data() + (s - s0) * ny, run.size() - (s - s0) * ny, tmp.data(), tmp.size());
+                        }
+                    });
+                    for (std::size_t j = 0; j < w; ++j) {
+                        const std::size_t at = slices * j / w * ny;
+                        add_into_(r.data() + at, r.size() - at, runs[j].data(), runs[j].size());
+                    }
+                    off = slices * ny;
+                }
+                for (; off + ny <= nx; off += ny) {
+                    mul_equal_(x.data() + off, y.data(), ny, part.data(), mr);
+                    add_into_(r.data() + off, r.size() - off, part.data(), part.size());
+                }
+                const std::size_t tail = nx - off;
+                if (tail != 0) {
+                    if (tail < karatsuba_threshold_) {
+                        mul_basecase_(y.data(), ny, x.data() + off, tail, part.data(), mr);
+                    } else {
+                        const mag_t t = mul_abs_(trimmed_(x.data() + off, tail, mr), y);
+                        std::fill(std::copy(t.begin(), t.end(), part.begin()), part.end(), 0U);
+                    }
+                    add_into_(r.data() + off, r.size() - off, part.data(), ny + tail);
+                }
             }
 
-            std::vector<std::uint32_t> r;
-            r.resize(tmp.size());
-            for (std::size_t i = 0; i < tmp.size(); ++i) r[i] = static_cast<std::uint32_t>(tmp[i]);
             while (!r.empty() && r.back() == 0U) r.pop_back();
             return r;
         }
 
-        static bool mul_small_(std::vector<std::uint32_t> &v, std::uint32_t m) {
+        static bool mul_small_(mag_t &v, std::uint32_t m) {
             if (v.empty() || m == 1U) return true;
             if (m == 0U) {
                 v.clear();
@@ -1749,7 +2898,7 @@ namespace usub::umath {
             return true;
         }
 
-        static bool div_small_(std::vector<std::uint32_t> &v, std::uint32_t d, std::uint32_t &rem) {
+        static bool div_small_(mag_t &v, std::uint32_t d, std::uint32_t &rem) {
             if (d == 0U) return false;
             std::uint64_t r = 0;
             for (std::size_t i = v.size(); i-- > 0;) {
@@ -1762,7 +2911,7 @@ namespace usub::umath {
             return true;
         }
 
-        static bool mul_pow10_(std::vector<std::uint32_t> &v, int k) {
+        static bool mul_pow10_(mag_t &v, int k) {
             if (k < 0) return false;
             if (v.empty() || k == 0) return true;
 
@@ -1770,8 +2919,7 @@ namespace usub::umath {
             const int rem = k % base_digits;
 
             if (limb_shift > 0) {
-                std::vector<std::uint32_t> out;
-                out.resize(static_cast<std::size_t>(limb_shift), 0U);
+                mag_t out(static_cast<std::size_t>(limb_shift), 0U, v.resource());
                 out.insert(out.end(), v.begin(), v.end());
                 v.swap(out);
             }
@@ -1783,62 +2931,235 @@ namespace usub::umath {
             return true;
         }
 
-        static std::pair<std::vector<std::uint32_t>, std::vector<std::uint32_t> >
-        div_mod_abs_(std::vector<std::uint32_t> a, std::vector<std::uint32_t> b) {
-            while (!a.empty() && a.back() == 0U) a.pop_back();
-            while (!b.empty() && b.back() == 0U) b.pop_back();
+        // Quotient and divisor length (in limbs) from which division goes through a Newton reciprocal instead
+        // of Knuth's algorithm D, and the size below which the reciprocal itself is computed with algorithm D.
+        static constexpr std::size_t newton_div_threshold_ = 300;
+        static constexpr std::size_t newton_recip_basecase_ = 64;
+
+        // Knuth's algorithm D. On entry u holds the dividend with one spare top limb and v (n >= 2 limbs) is
+        // normalized so that v[n - 1] >= base / 2. On exit q holds the quotient and u[0, n) the remainder.
+        static void div_knuth_(std::uint32_t *u, std::size_t un, const std::uint32_t *v, std::size_t n,
+                               std::uint32_t *q) noexcept {
+            const std::uint64_t v1 = v[n - 1];
+            const std::uint64_t v2 = v[n - 2];
+
+            for (std::size_t j = un - n; j-- > 0;) {
+                const std::uint64_t num = static_cast<std::uint64_t>(u[j + n]) * base + u[j + n - 1];
+                std::uint64_t qhat = num / v1;
+                std::uint64_t rhat = num % v1;
+                while (qhat >= base || qhat * v2 > rhat * base + u[j + n - 2]) {
+                    --qhat;
+                    rhat += v1;
+                    if (rhat >= base) break;
+                }
+
+                std::uint64_t carry = 0;
+                std::uint32_t borrow = 0;
+                for (std::size_t i = 0; i < n; ++i) {
+                    const std::uint64_t p = qhat * v[i] + carry;
+                    carry = p / base;
+                    const auto d = static_cast<std::uint32_t>(p - carry * base) + borrow;
+                    borrow = u[i + j] < d;
+                    u[i + j] = borrow ? u[i + j] + base - d : u[i + j] - d;
+                }
+                const std::uint64_t top = carry + borrow;
+                if (u[j + n] < top) {
+                    --qhat;
+                    add_into_(u + j, n, v, n);
+                    u[j + n] = 0U;
+                } else {
+                    u[j + n] = static_cast<std::uint32_t>(u[j + n] - top);
+                }
+                q[j] = static_cast<std::uint32_t>(qhat);
+            }
+        }
+
+        static void trim_(mag_t &v) noexcept {
+            while (!v.empty() && v.back() == 0U) v.pop_back();
+        }
+
+        static mag_t shifted_(const mag_t &v, std::ptrdiff_t limbs) {
+            if (limbs >= 0) {
+                mag_t r(static_cast<std::size_t>(limbs), 0U, v.resource());
+                r.insert(r.end(), v.begin(), v.end());
+                return r;
+            }
+            const auto drop = static_cast<std::size_t>(-limbs);
+            if (drop >= v.size()) return mag_t(v.resource());
+            return {v.begin() + static_cast<std::ptrdiff_t>(drop), v.end(), v.resource()};
+        }
+
+        // floor(base^(2t) / d) for a t-limb d, by Newton iteration with doubling precision.
+        static mag_t reciprocal_(const mag_t &d, unsigned threads = 1,
+                                 std::pmr::memory_resource *worker_mr = std::pmr::new_delete_resource()) {
+            const std::size_t t = d.size();
+            mag_t pow(2 * t + 1, 0U, d.resource());
+            pow.back() = 1U;
+
+            if (t <= newton_recip_basecase_) return div_mod_abs_(std::move(pow), d).first;
+
+            // One Newton step squares the relative error, so h leading limbs leave x within a unit of the
+            // answer once 2 * (h - 1) exceeds t + 1.
+            const std::size_t h = t / 2 + 3;
+            const mag_t dh(d.end() - static_cast<std::ptrdiff_t>(h), d.end(), d.resource());
+            mag_t x = shifted_(reciprocal_(dh, threads, worker_mr), static_cast<std::ptrdiff_t>(t - h));
+
+            // x += x * (base^(2t) - d * x) / base^(2t)
+            const signed_mag_ e = signed_sub_({pow}, {mul_abs_(d, x, threads, worker_mr)});
+            signed_mag_ step{shifted_(mul_abs_(x, e.mag, threads, worker_mr), -static_cast<std::ptrdiff_t>(2 * t)),
+                             e.neg};
+            trim_(step.mag);
+            x = signed_add_({x}, step).mag;
+
+            correct_quotient_(x, pow, d, threads, worker_mr);
+            return x;
+        }
+
+        // Adjusts q by a few units until 0 <= n - q * d < d.
+        static mag_t correct_quotient_(mag_t &q, const mag_t &n, const mag_t &d, unsigned threads = 1,
+                                       std::pmr::memory_resource *worker_mr = std::pmr::new_delete_resource()) {
+            signed_mag_ r = signed_sub_({n}, {mul_abs_(q, d, threads, worker_mr)});
+            const mag_t one{1U};
+            while (r.neg) {
+                q = sub_abs_(q, one);
+                r = signed_add_(r, {d});
+            }
+            while (cmp_abs_(r.mag, d) >= 0) {
+                add_one_(q);
+                r.mag = sub_abs_(r.mag, d);
+            }
+            return std::move(r.mag);
+        }
+
+        // Quotient of ql limbs via a (ql + 1)-limb reciprocal of the divisor's leading limbs.
+        static std::pair<mag_t, mag_t>
+        div_newton_(const mag_t &a, const mag_t &b, unsigned threads, std::pmr::memory_resource *worker_mr) {
+            const std::size_t t = a.size() - b.size() + 2;
+            const auto s = static_cast<std::ptrdiff_t>(t) - static_cast<std::ptrdiff_t>(b.size());
+
+            const mag_t r = reciprocal_(shifted_(b, s), threads, worker_mr);
+            mag_t q = shifted_(mul_abs_(shifted_(a, s), r, threads, worker_mr), -static_cast<std::ptrdiff_t>(2 * t));
+            trim_(q);
+            mag_t rem = correct_quotient_(q, a, b, threads, worker_mr);
+            trim_(q);
+            return {std::move(q), std::move(rem)};
+        }
+
+        // Intermediates, quotient and remainder come from a's memory resource. Only the Newton path uses threads
+        // (and worker_mr).
+        static std::pair<mag_t, mag_t>
+        div_mod_abs_(mag_t a, mag_t b, unsigned threads = 1,
+                     std::pmr::memory_resource *worker_mr = std::pmr::new_delete_resource()) {
+            trim_(a);
+            trim_(b);
             if (b.empty()) return {{}, {}};
             if (a.empty()) return {{}, {}};
 
-            if (cmp_abs_(a, b) < 0) return {{}, a};
+            if (cmp_abs_(a, b) < 0) return {{}, std::move(a)};
+
+            if (b.size() == 1) {
+                std::uint32_t rem = 0;
+                div_small_(a, b[0], rem);
+                if (rem == 0U) return {std::move(a), {}};
+                return {std::move(a), {rem}};
+            }
+
+            if (std::min(a.size() - b.size() + 1, b.size()) >= newton_div_threshold_) {
+                return div_newton_(a, b, threads, worker_mr);
+            }
 
+            const std::size_t la = a.size();
             const auto f = static_cast<std::uint32_t>(base / (static_cast<std::uint64_t>(b.back()) + 1ULL));
             if (f != 1U) {
                 mul_small_(a, f);
                 mul_small_(b, f);
             }
+            a.resize(la + 1, 0U);
 
-            std::vector<std::uint32_t> q;
-            q.assign(a.size(), 0U);
+            mag_t q(la + 1 - b.size(), 0U, a.resource());
+            div_knuth_(a.data(), a.size(), b.data(), b.size(), q.data());
 
-            std::vector<std::uint32_t> r;
+            a.resize(b.size());
+            trim_(a);
+            if (f != 1U && !a.empty()) {
+                std::uint32_t rem = 0;
+                div_small_(a, f, rem);
+            }
+            trim_(q);
+            return {std::move(q), std::move(a)};
+        }
 
-            for (std::size_t i = a.size(); i-- > 0;) {
-                if (!r.empty() || a[i] != 0U) r.insert(r.begin(), a[i]);
-                else r.insert(r.begin(), 0U);
-                while (!r.empty() && r.back() == 0U) r.pop_back();
+        // *this += b with b's sign taken as bneg.
+        self &add_signed_(const self &b, bool bneg) noexcept {
+            if (!ok()) return *this;
+            if (!b.ok()) {
+                set_error_(b.err_);
+                return *this;
+            }
+            if (&b == this) {
+                const self copy = b;
+                return add_signed_(copy, bneg);
+            }
 
-                std::uint64_t s1 = (r.size() > b.size()) ? r[b.size()] : 0ULL;
-                std::uint64_t s0 = (r.size() > b.size() - 1) ? r[b.size() - 1] : 0ULL;
+            const int res_scale = std::max(scale_, b.scale_);
+            if (!rescale_up_(res_scale)) {
+                set_error_(Err::Overflow);
+                return *this;
+            }
 
-                std::uint64_t d = (s1 * base + s0) / b.back();
-                if (d >= base) d = base - 1;
+            mag_t scaled(resource());
+            const mag_t *bm = &b.mag_;
+            if (b.scale_ < res_scale && !b.mag_.empty()) {
+                scaled = b.mag_;
+                if (!mul_pow10_(scaled, res_scale - b.scale_)) {
+                    set_error_(Err::Overflow);
+                    return *this;
+                }
+                bm = &scaled;
+            }
 
-                std::vector<std::uint32_t> bd = b;
-                if (d != 0) {
-                    mul_small_(bd, static_cast<std::uint32_t>(d));
+            if (bm->empty()) {
+                // Nothing to add.
+            } else if (mag_.empty()) {
+                mag_ = *bm;
+                neg_ = bneg;
+            } else if (neg_ == bneg) {
+                add_abs_in_(mag_, *bm);
+            } else {
+                const int c = cmp_abs_(mag_, *bm);
+                if (c > 0) {
+                    sub_from_(mag_.data(), mag_.size(), bm->data(), bm->size());
+                } else if (c < 0) {
+                    rsub_abs_in_(mag_, *bm);
+                    neg_ = bneg;
                 } else {
-                    bd.clear();
+                    mag_.clear();
                 }
+            }
+            scale_ = res_scale;
 
-                while (!bd.empty() && cmp_abs_(r, bd) < 0) {
-                    --d;
-                    bd = b;
-                    mul_small_(bd, static_cast<std::uint32_t>(d));
-                }
+            normalize_();
+            if (!check_limits_()) set_error_(Err::Overflow);
+            return *this;
+        }
 
-                if (!bd.empty()) r = sub_abs_(r, bd);
-                q[i] = static_cast<std::uint32_t>(d);
+        // r *= b. Products that fit the stack buffer are copied back into r's existing limbs.
+        static void mul_abs_in_(mag_t &r, const mag_t &b) {
+            if (b.size() == 1) {
+                mul_small_(r, b[0]);
+                return;
             }
 
-            while (!q.empty() && q.back() == 0U) q.pop_back();
-
-            if (f != 1U && !r.empty()) {
-                std::uint32_t rem = 0;
-                div_small_(r, f, rem);
+            const std::size_t n = r.size() + b.size();
+            if (std::min(r.size(), b.size()) < karatsuba_threshold_ && n <= 2 * karatsuba_threshold_) {
+                std::uint32_t tmp[2 * karatsuba_threshold_];
+                mul_basecase_(r.data(), r.size(), b.data(), b.size(), tmp, r.resource());
+                r.assign(tmp, tmp + n);
+                trim_(r);
+                return;
             }
 
-            return {q, r};
+            r = mul_abs_(r, b);
         }
 
         bool rescale_up_(int new_scale) noexcept {
@@ -2006,19 +3327,6 @@ namespace usub::umath {
             if (carry != 0) mag_.push_back(static_cast<std::uint32_t>(carry));
         }
 
-        [[nodiscard]] std::string mag_to_decimal_() const {
-            if (mag_.empty()) return "0";
-            std::string s = std::to_string(mag_.back());
-            for (std::size_t i = mag_.size() - 1; i-- > 0;) {
-                std::string block = std::to_string(mag_[i]);
-                if (block.size() < static_cast<std::size_t>(base_digits)) {
-                    s.append(static_cast<std::size_t>(base_digits) - block.size(), '0');
-                }
-                s += block;
-            }
-            return s;
-        }
-
         template<std::integral I>
             requires (!std::same_as<std::remove_cvref_t<I>, bool>)
         static self from_integral_(I v) noexcept {
@@ -2078,6 +3386,397 @@ namespace usub::umath {
             }
         }
     };
+
+    namespace detail {
+        struct numeric_access {
+            template<class N, class R>
+            static N make(R raw, Err e) noexcept {
+                N v;
+                v.raw_ = e == Err::None ? raw : R{};
+                v.err_ = e;
+                return v;
+            }
+
+            // Splits |raw| into base-1e9 limbs; the value keeps the fixed type's scale.
+            static Numeric numeric_from_raw(int256 raw, int scale, Err e, std::pmr::memory_resource *mr) noexcept {
+                Numeric out(std::int64_t{0}, mr);
+                if (e != Err::None) {
+                    out.set_error_(e);
+                    return out;
+                }
+                uint256 m = abs_u256(raw);
+                while (m != uint256{0U}) {
+                    uint256 rem{};
+                    m = div_pow10_u256(m, Numeric::base_digits, rem);
+                    out.mag_.push_back(static_cast<std::uint32_t>(static_cast<std::uint64_t>(rem)));
+                }
+                out.scale_ = scale;
+                out.neg_ = raw.is_negative();
+                out.normalize_();
+                return out;
+            }
+
+            static std::span<const std::uint32_t> limbs(const Numeric &v) noexcept {
+                return {v.mag_.data(), v.mag_.size()};
+            }
+
+            // A Numeric with the given base-1e9 magnitude, or the error e; Overflow past Numeric's limits.
+            static Numeric numeric_from_limbs(std::span<const std::uint32_t> mag, bool neg, int scale, Err e,
+                                              std::pmr::memory_resource *mr) noexcept {
+                Numeric out(std::int64_t{0}, mr);
+                if (e != Err::None) {
+                    out.set_error_(e);
+                    return out;
+                }
+                out.mag_.assign(mag.begin(), mag.end());
+                out.scale_ = scale;
+                out.neg_ = neg;
+                out.normalize_();
+                if (!out.check_limits_()) out.set_error_(Err::Overflow);
+                return out;
+            }
+
+            // Rounds v to scale S and joins its limbs back into a 256-bit raw value; false if v needs more
+            // than P digits at that scale.
+            template<int P, int S>
+            static bool numeric_to_raw(const Numeric &v, Rounding rnd, int256 &raw) noexcept {
+                static_assert(P <= 76, "a 256-bit raw value holds at most 76 digits");
+                Numeric t(v);
+                if (!t.rescale_(S, rnd)) return false;
+                if (t.is_zero_()) {
+                    raw = int256{0};
+                    return true;
+                }
+                if (t.decimal_digits_() > P) return false;
+                uint256 m{0U};
+                for (std::size_t i = t.mag_.size(); i-- > 0;) {
+                    m = m * uint256{Numeric::base} + uint256{t.mag_[i]};
+                }
+                raw = apply_sign_u256(m, t.neg_);
+                return true;
+            }
+        };
+
+        // Exact value v at scale Se rounded (or widened) to N's scale; Overflow if it needs more than N's
+        // precision.
+        template<class N, int Se>
+        N narrow_scaled(int256 v, Rounding rnd) noexcept {
+            using raw_t = decltype(std::declval<const N &>().raw());
+            if constexpr (Se >= N::scale) {
+                v = round_pow10_i256(v, static_cast<unsigned>(Se - N::scale), rnd);
+            } else {
+                constexpr int up = N::scale - Se;
+                if (abs_u256(v) >= pow10_u256(static_cast<unsigned>(std::max(N::precision - up, 0)))) {
+                    return numeric_access::make<N>(raw_t{0}, Err::Overflow);
+                }
+                v = v * int256(pow10_u256(static_cast<unsigned>(up)));
+            }
+            if (!fits_precision_i256<N::precision>(v)) return numeric_access::make<N>(raw_t{0}, Err::Overflow);
+            if constexpr (std::is_same_v<raw_t, int256>) return numeric_access::make<N>(v, Err::None);
+            else return numeric_access::make<N>(apply_sign(abs_u256(v).low(), v.is_negative()), Err::None);
+        }
+
+        // Result type of a mixed Numeric128 operation that needs I integer and S fraction digits. Beyond 38
+        // digits the integer part wins and the scale shrinks, but not below min(S, 6).
+        template<int I, int S>
+        struct numeric128_fit {
+            static constexpr int scale = I + S <= 38 ? S : std::clamp(std::max(std::min(S, 6), 38 - I), 0, 38);
+            static constexpr int precision = std::clamp(I + S, std::max(scale, 1), 38);
+            using type = Numeric128<precision, scale>;
+        };
+
+        template<class A, class B>
+        concept distinct_numeric128 = !std::same_as<A, B>;
+    } // namespace detail
+
+    // Result types of mixed-type Numeric128 arithmetic. A sum keeps the larger scale plus a carry digit and a
+    // product adds precisions and scales; those scales are PostgreSQL's. PostgreSQL picks a quotient's scale
+    // from the operand values at run time, so the quotient scale (at least 6, s1 + p2 + 1 when larger) and the
+    // 38-digit cap follow SQL Server's DECIMAL rules instead, which need only the operand types.
+    template<class A, class B>
+    using numeric128_add_t = typename detail::numeric128_fit<
+        std::max(A::precision - A::scale, B::precision - B::scale) + 1, std::max(A::scale, B::scale)>::type;
+
+    template<class A, class B>
+    using numeric128_mul_t = typename detail::numeric128_fit<
+        A::precision - A::scale + B::precision - B::scale, A::scale + B::scale>::type;
+
+    template<class A, class B>
+    using numeric128_div_t = typename detail::numeric128_fit<
+        A::precision - A::scale + B::scale, std::max(6, A::scale + B::precision + 1)>::type;
+
+    // Mixed-type operations. Operands are aligned with compile-time powers of ten and combined exactly in 256
+    // bits; the result is rounded only if its type has fewer fraction digits than the exact value.
+    template<int P1, int S1, int P2, int S2>
+    auto add(const Numeric128<P1, S1> &a, const Numeric128<P2, S2> &b, Rounding rnd = Rounding::HalfUp) noexcept {
+        using R = numeric128_add_t<Numeric128<P1, S1>, Numeric128<P2, S2>>;
+        if (!a.ok()) return detail::numeric_access::make<R>(int128{0}, a.error());
+        if (!b.ok()) return detail::numeric_access::make<R>(int128{0}, b.error());
+
+        constexpr int Se = std::max(S1, S2);
+        const int256 fa(detail::pow10_u256(static_cast<unsigned>(Se - S1)));
+        const int256 fb(detail::pow10_u256(static_cast<unsigned>(Se - S2)));
+        return detail::narrow_scaled<R, Se>(detail::widen_i256(a.raw()) * fa + detail::widen_i256(b.raw()) * fb,
+                                            rnd);
+    }
+
+    template<int P1, int S1, int P2, int S2>
+    auto sub(const Numeric128<P1, S1> &a, const Numeric128<P2, S2> &b, Rounding rnd = Rounding::HalfUp) noexcept {
+        using R = numeric128_add_t<Numeric128<P1, S1>, Numeric128<P2, S2>>;
+        if (!a.ok()) return detail::numeric_access::make<R>(int128{0}, a.error());
+        if (!b.ok()) return detail::numeric_access::make<R>(int128{0}, b.error());
+
+        constexpr int Se = std::max(S1, S2);
+        const int256 fa(detail::pow10_u256(static_cast<unsigned>(Se - S1)));
+        const int256 fb(detail::pow10_u256(static_cast<unsigned>(Se - S2)));
+        return detail::narrow_scaled<R, Se>(detail::widen_i256(a.raw()) * fa - detail::widen_i256(b.raw()) * fb,
+                                            rnd);
+    }
+
+    template<int P1, int S1, int P2, int S2>
+    auto mul(const Numeric128<P1, S1> &a, const Numeric128<P2, S2> &b, Rounding rnd = Rounding::HalfUp) noexcept {
+        using R = numeric128_mul_t<Numeric128<P1, S1>, Numeric128<P2, S2>>;
+        if (!a.ok()) return detail::numeric_access::make<R>(int128{0}, a.error());
+        if (!b.ok()) return detail::numeric_access::make<R>(int128{0}, b.error());
+
+        return detail::narrow_scaled<R, S1 + S2>(detail::widen_i256(a.raw()) * detail::widen_i256(b.raw()), rnd);
+    }
+
+    template<int P1, int S1, int P2, int S2>
+    auto div(const Numeric128<P1, S1> &a, const Numeric128<P2, S2> &b, Rounding rnd = Rounding::HalfUp) noexcept {
+        using R = numeric128_div_t<Numeric128<P1, S1>, Numeric128<P2, S2>>;
+        if (!a.ok()) return detail::numeric_access::make<R>(int128{0}, a.error());
+        if (!b.ok()) return detail::numeric_access::make<R>(int128{0}, b.error());
+        if (b.raw() == int128{0}) return detail::numeric_access::make<R>(int128{0}, Err::DivByZero);
+
+        // raw(a / b) = a.raw * 10^E / b.raw. A negative E scales the divisor instead; a positive one is applied
+        // by long division in steps of 10^38, which keep the partial remainder product within 256 bits.
+        constexpr int E = R::scale + S2 - S1;
+        const uint256 den = uint256{detail::abs_u(b.raw())} *
+                            detail::pow10_u256(static_cast<unsigned>(E < 0 ? -E : 0));
+        uint256 rem{};
+        uint256 q = detail::div_u256(uint256{detail::abs_u(a.raw())}, den, rem);
+        for (int left = E; left > 0;) {
+            const int step = std::min(left, 38);
+            const uint256 f = detail::pow10_u256(static_cast<unsigned>(step));
+            if (!(q < detail::precision_bound_u256<R::precision>)) break;
+            uint256 r2{};
+            q = q * f + detail::div_u256(rem * f, den, r2);
+            rem = r2;
+            left -= step;
+        }
+        if (rnd == Rounding::HalfUp && rem + rem >= den) q += uint256{1U};
+        if (!(q < detail::precision_bound_u256<R::precision>)) {
+            return detail::numeric_access::make<R>(int128{0}, Err::Overflow);
+        }
+        const bool neg = (a.raw().high() < 0) != (b.raw().high() < 0);
+        return detail::numeric_access::make<R>(detail::apply_sign(q.low(), neg), Err::None);
+    }
+
+    template<int P1, int S1, int P2, int S2>
+        requires detail::distinct_numeric128<Numeric128<P1, S1>, Numeric128<P2, S2>>
+    auto operator+(const Numeric128<P1, S1> &a, const Numeric128<P2, S2> &b) noexcept { return add(a, b); }
+
+    template<int P1, int S1, int P2, int S2>
+        requires detail::distinct_numeric128<Numeric128<P1, S1>, Numeric128<P2, S2>>
+    auto operator-(const Numeric128<P1, S1> &a, const Numeric128<P2, S2> &b) noexcept { return sub(a, b); }
+
+    template<int P1, int S1, int P2, int S2>
+        requires detail::distinct_numeric128<Numeric128<P1, S1>, Numeric128<P2, S2>>
+    auto operator*(const Numeric128<P1, S1> &a, const Numeric128<P2, S2> &b) noexcept { return mul(a, b); }
+
+    template<int P1, int S1, int P2, int S2>
+        requires detail::distinct_numeric128<Numeric128<P1, S1>, Numeric128<P2, S2>>
+    auto operator/(const Numeric128<P1, S1> &a, const Numeric128<P2, S2> &b) noexcept { return div(a, b); }
+
+    namespace detail {
+        template<class T>
+        struct is_fixed_decimal : std::false_type {
+        };
+
+        template<int P, int S>
+        struct is_fixed_decimal<Numeric128<P, S>> : std::true_type {
+        };
+
+        template<int P, int S>
+        struct is_fixed_decimal<Numeric256<P, S>> : std::true_type {
+        };
+
+        template<class T>
+        concept decimal_type = is_fixed_decimal<T>::value || std::same_as<T, Numeric>;
+
+        template<int P, int S>
+        int256 wide_raw(const Numeric128<P, S> &v) noexcept { return widen_i256(v.raw()); }
+
+        template<int P, int S>
+        int256 wide_raw(const Numeric256<P, S> &v) noexcept { return v.raw(); }
+    } // namespace detail
+
+    // Converts between Numeric128, Numeric256 and Numeric without a round trip through strings. The raw value
+    // is split into (or joined from) base-1e9 limbs; a smaller target scale rounds with rnd, and a value that
+    // needs more than the target's precision is Overflow. Errors carry over unchanged.
+    template<detail::decimal_type To, detail::decimal_type From>
+    To numeric_cast(const From &v, Rounding rnd = Rounding::HalfUp) noexcept {
+        if constexpr (std::same_as<To, From>) {
+            return v;
+        } else if constexpr (std::same_as<To, Numeric>) {
+            return detail::numeric_access::numeric_from_raw(detail::wide_raw(v), From::scale, v.error(),
+                                                            std::pmr::get_default_resource());
+        } else {
+            using raw_t = decltype(std::declval<const To &>().raw());
+            if (!v.ok()) return detail::numeric_access::make<To>(raw_t{0}, v.error());
+            if constexpr (std::same_as<From, Numeric>) {
+                int256 raw{0};
+                if (!detail::numeric_access::numeric_to_raw<To::precision, To::scale>(v, rnd, raw)) {
+                    return detail::numeric_access::make<To>(raw_t{0}, Err::Overflow);
+                }
+                return detail::narrow_scaled<To, To::scale>(raw, rnd);
+            } else {
+                return detail::narrow_scaled<To, From::scale>(detail::wide_raw(v), rnd);
+            }
+        }
+    }
+
+    // Exact running sum of Numeric values. Limbs are kept as signed 64-bit base-1e9 digits at the largest scale
+    // added so far, and carries are propagated only every carry_interval additions, so add() neither rescales
+    // nor reallocates once the buffer is long enough. Accumulators filled on different threads combine with
+    // merge(); the total does not depend on the order of additions or merges. The first input error is kept.
+    class NumericAccumulator {
+    public:
+        explicit NumericAccumulator(std::pmr::memory_resource *mr = std::pmr::get_default_resource())
+            : digits_(mr) {
+        }
+
+        [[nodiscard]] std::pmr::memory_resource *resource() const noexcept {
+            return digits_.get_allocator().resource();
+        }
+
+        [[nodiscard]] Err error() const noexcept { return err_; }
+        [[nodiscard]] int scale() const noexcept { return scale_; }
+
+        NumericAccumulator &add(const Numeric &v) { return add_signed_(v, false); }
+        NumericAccumulator &sub(const Numeric &v) { return add_signed_(v, true); }
+        NumericAccumulator &operator+=(const Numeric &v) { return add(v); }
+        NumericAccumulator &operator-=(const Numeric &v) { return sub(v); }
+
+        NumericAccumulator &merge(const NumericAccumulator &o) {
+            if (err_ == Err::None) err_ = o.err_;
+            if (o.digits_.empty()) return *this;
+            if (o.scale_ < scale_) {
+                NumericAccumulator t(resource());
+                t.digits_.assign(o.digits_.begin(), o.digits_.end());
+                t.scale_ = o.scale_;
+                t.rescale_up_(scale_);
+                return add_digits_(t.digits_, 0);
+            }
+            if (o.scale_ > scale_) rescale_up_(o.scale_);
+            return add_digits_(o.digits_, o.pending_);
+        }
+
+        // The total at scale(), allocated from resource(); Overflow if it exceeds Numeric's limits.
+        [[nodiscard]] Numeric result() const {
+            NumericAccumulator t(resource());
+            t.digits_.assign(digits_.begin(), digits_.end());
+            t.normalize_();
+            const bool neg = !t.digits_.empty() && t.digits_.back() < 0;
+            if (neg) {
+                for (std::int64_t &d: t.digits_) d = -d;
+                t.normalize_();
+            }
+
+            std::pmr::vector<std::uint32_t> mag(t.digits_.size(), resource());
+            for (std::size_t i = 0; i < mag.size(); ++i) mag[i] = static_cast<std::uint32_t>(t.digits_[i]);
+            return detail::numeric_access::numeric_from_limbs(mag, neg, scale_, err_, resource());
+        }
+
+        void clear() noexcept {
+            digits_.clear();
+            scale_ = 0;
+            pending_ = 0;
+            err_ = Err::None;
+        }
+
+    private:
+        static constexpr std::int64_t base = 1'000'000'000;
+        static constexpr int base_digits = 9;
+        // An addition moves each digit by less than 2 * base, so 2^31 of them cannot overflow an int64_t.
+        static constexpr std::uint64_t carry_interval = std::uint64_t{1} << 31;
+
+        std::pmr::vector<std::int64_t> digits_;
+        int scale_ = 0;
+        std::uint64_t pending_ = 0;
+        Err err_ = Err::None;
+
+        static std::uint64_t pow10_(int k) noexcept { return detail::pow10_divisors[static_cast<std::size_t>(k)].value; }
+
+        NumericAccumulator &add_signed_(const Numeric &v, bool negate) {
+            if (!v.ok()) {
+                if (err_ == Err::None) err_ = v.error();
+                return *this;
+            }
+            const std::span<const std::uint32_t> mag = detail::numeric_access::limbs(v);
+            if (mag.empty()) return *this;
+            if (v.scale() > scale_) rescale_up_(v.scale());
+
+            const int shift = scale_ - v.scale();
+            const auto at = static_cast<std::size_t>(shift / base_digits);
+            const std::uint64_t mult = pow10_(shift % base_digits);
+            if (digits_.size() < at + mag.size() + 1) digits_.resize(at + mag.size() + 1, 0);
+
+            const std::int64_t sign = v.negative() != negate ? -1 : 1;
+            std::int64_t *d = digits_.data() + at;
+            if (mult == 1) {
+                for (std::size_t i = 0; i < mag.size(); ++i) d[i] += sign * mag[i];
+            } else {
+                for (std::size_t i = 0; i < mag.size(); ++i) {
+                    const std::uint64_t p = mag[i] * mult;
+                    d[i] += sign * static_cast<std::int64_t>(p % base);
+                    d[i + 1] += sign * static_cast<std::int64_t>(p / base);
+                }
+            }
+            if (++pending_ >= carry_interval) normalize_();
+            return *this;
+        }
+
+        // Adds digits that have absorbed up to `pending` additions since their last normalization.
+        NumericAccumulator &add_digits_(const std::pmr::vector<std::int64_t> &o, std::uint64_t pending) {
+            normalize_();
+            if (digits_.size() < o.size()) digits_.resize(o.size(), 0);
+            for (std::size_t i = 0; i < o.size(); ++i) digits_[i] += o[i];
+            pending_ = pending + 1;
+            if (pending_ >= carry_interval) normalize_();
+            return *this;
+        }
+
+        // Brings every digit but the top one into [0, base); the top digit carries the sign.
+        void normalize_() {
+            std::int64_t carry = 0;
+            for (std::int64_t &d: digits_) {
+                const std::int64_t v = d + carry;
+                carry = v / base - (v % base < 0);
+                d = v - carry * base;
+            }
+            while (carry >= base) {
+                digits_.push_back(carry % base);
+                carry /= base;
+            }
+            if (carry != 0) digits_.push_back(carry);
+            while (!digits_.empty() && digits_.back() == 0) digits_.pop_back();
+            pending_ = 0;
+        }
+
+        void rescale_up_(int new_scale) {
+            normalize_();
+            const int k = new_scale - scale_;
+            scale_ = new_scale;
+            if (digits_.empty()) return;
+
+            const auto mult = static_cast<std::int64_t>(pow10_(k % base_digits));
+            for (std::int64_t &d: digits_) d *= mult;
+            digits_.insert(digits_.begin(), static_cast<std::size_t>(k / base_digits), 0);
+            normalize_();
+        }
+    };
 } // namespace unumber::numeric
 
 #endif // UNUMBER_NUMERIC_FIXED_H
@@ -0,0 +1,525 @@
+#ifndef UNUMBER_NUMERIC_COLUMN_H
+#define UNUMBER_NUMERIC_COLUMN_H
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <span>
+#include <vector>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#endif
+
+#include "Numeric.h"
+
+namespace usub::umath {
+    namespace detail {
+        template<class T, std::size_t Align>
+        struct aligned_allocator {
+            using value_type = T;
+
+            template<class U>
+            struct rebind {
+                using other = aligned_allocator<U, Align>;
+            };
+
+            constexpr aligned_allocator() noexcept = default;
+
+            template<class U>
+            constexpr aligned_allocator(const aligned_allocator<U, Align> &) noexcept {}
+
+            T *allocate(std::size_t n) {
+                return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t{Align}));
+            }
+
+            void deallocate(T *p, std::size_t) noexcept {
+                ::operator delete(p, std::align_val_t{Align});
+            }
+
+            template<class U>
+            friend bool operator==(const aligned_allocator &, const aligned_allocator<U, Align> &) noexcept {
+                return true;
+            }
+        };
+
+        // Two status bits per row, 32 rows per word; 0 is Err::None.
+        inline constexpr std::size_t status_rows_per_word = 32;
+        inline constexpr std::uint64_t status_lo_bits = 0x5555555555555555ULL;
+        static_assert(static_cast<unsigned>(Err::Overflow) == 2, "overflow is the high bit of a status lane");
+
+        // Per row: a's error if it has one, otherwise b's.
+        constexpr std::uint64_t merge_status(std::uint64_t a, std::uint64_t b) noexcept {
+            const std::uint64_t a_set = (a | (a >> 1)) & status_lo_bits;
+            const std::uint64_t m = a_set | (a_set << 1);
+            return (a & m) | (b & ~m);
+        }
+
+        // Moves bit k of a 32-bit row mask to bit 2k (the low bit of row k's status lane).
+        constexpr std::uint64_t spread_row_mask(std::uint32_t m) noexcept {
+            std::uint64_t x = m;
+            x = (x | (x << 16)) & 0x0000FFFF0000FFFFULL;
+            x = (x | (x << 8)) & 0x00FF00FF00FF00FFULL;
+            x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+            x = (x | (x << 2)) & 0x3333333333333333ULL;
+            x = (x | (x << 1)) & status_lo_bits;
+            return x;
+        }
+
+        // r satisfies |r| < 10^P iff (r + bias) as an unsigned value is <= limit.
+        struct raw_bounds {
+            uint128 bias;
+            uint128 limit;
+        };
+
+        template<int P>
+        inline constexpr raw_bounds raw_bounds_for{
+            pow10_u_table[P] - uint128{0, 1},
+            pow10_u_table[P] + pow10_u_table[P] - uint128{0, 2},
+        };
+
+        inline bool raw_fits(const int128 &r, const raw_bounds &bd) noexcept {
+            return uint128{static_cast<std::uint64_t>(r.high()), r.low()} + bd.bias <= bd.limit;
+        }
+
+        // Block kernels handle at most 64 rows and return a bit per row that falls outside the bounds.
+        using add_sub_block_fn = std::uint64_t (*)(const int128 *, const int128 *, int128 *, std::size_t,
+                                                   const raw_bounds &) noexcept;
+        using negate_fn = void (*)(const int128 *, int128 *, std::size_t) noexcept;
+        using cmp_fn = void (*)(const int128 *, const int128 *, std::int8_t *, std::size_t) noexcept;
+
+        template<bool Sub>
+        std::uint64_t add_sub_block_scalar(const int128 *a, const int128 *b, int128 *out, std::size_t n,
+                                           const raw_bounds &bd) noexcept {
+            std::uint64_t m = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                const int128 r = Sub ? a[i] - b[i] : a[i] + b[i];
+                out[i] = r;
+                m |= std::uint64_t{!raw_fits(r, bd)} << i;
+            }
+            return m;
+        }
+
+        inline void negate_scalar(const int128 *a, int128 *out, std::size_t n) noexcept {
+            for (std::size_t i = 0; i < n; ++i) out[i] = -a[i];
+        }
+
+        inline void cmp_scalar(const int128 *a, const int128 *b, std::int8_t *out, std::size_t n) noexcept {
+            for (std::size_t i = 0; i < n; ++i) out[i] = static_cast<std::int8_t>((a[i] > b[i]) - (a[i] < b[i]));
+        }
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+        // int128 keeps hi_ then lo_, so every 128-bit lane holds the high word in qword 0 and the low word in
+        // qword 1. Carries and borrows move from qword 1 to qword 0 with a per-lane byte shift.
+        template<bool Sub>
+        __attribute__((target("avx2")))
+        std::uint64_t add_sub_block_avx2(const int128 *a, const int128 *b, int128 *out, std::size_t n,
+                                         const raw_bounds &bd) noexcept {
+            const __m256i sb = _mm256_set1_epi64x(std::numeric_limits<std::int64_t>::min());
+            const __m256i bias = _mm256_setr_epi64x(
+                static_cast<long long>(bd.bias.high()), static_cast<long long>(bd.bias.low()),
+                static_cast<long long>(bd.bias.high()), static_cast<long long>(bd.bias.low()));
+            const __m256i lim = _mm256_setr_epi64x(
+                static_cast<long long>(bd.limit.high()), static_cast<long long>(bd.limit.low()),
+                static_cast<long long>(bd.limit.high()), static_cast<long long>(bd.limit.low()));
+            const __m256i lim_x = _mm256_xor_si256(lim, sb);
+
+            std::uint64_t m = 0;
+            std::size_t i = 0;
+            for (; i + 2 <= n; i += 2) {
+                const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+                const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+                const __m256i ax = _mm256_xor_si256(va, sb);
+                __m256i r;
+                if constexpr (Sub) {
+                    const __m256i borrow = _mm256_cmpgt_epi64(_mm256_xor_si256(vb, sb), ax);
+                    r = _mm256_add_epi64(_mm256_sub_epi64(va, vb), _mm256_bsrli_epi128(borrow, 8));
+                } else {
+                    const __m256i sum = _mm256_add_epi64(va, vb);
+                    const __m256i carry = _mm256_cmpgt_epi64(ax, _mm256_xor_si256(sum, sb));
+                    r = _mm256_sub_epi64(sum, _mm256_bsrli_epi128(carry, 8));
+                }
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), r);
+
+                __m256i u = _mm256_add_epi64(r, bias);
+                const __m256i ux0 = _mm256_xor_si256(u, sb);
+                const __m256i c = _mm256_cmpgt_epi64(_mm256_xor_si256(r, sb), ux0);
+                u = _mm256_sub_epi64(u, _mm256_bsrli_epi128(c, 8));
+                const __m256i gt = _mm256_cmpgt_epi64(_mm256_xor_si256(u, sb), lim_x);
+                const __m256i eq = _mm256_cmpeq_epi64(u, lim);
+                const __m256i over = _mm256_or_si256(gt, _mm256_and_si256(eq, _mm256_bsrli_epi128(gt, 8)));
+                const int bits = _mm256_movemask_pd(_mm256_castsi256_pd(over));
+                m |= static_cast<std::uint64_t>((bits & 1) | ((bits >> 1) & 2)) << i;
+            }
+            if (i < n) m |= add_sub_block_scalar<Sub>(a + i, b + i, out + i, n - i, bd) << i;
+            return m;
+        }
+
+        __attribute__((target("avx2")))
+        inline void negate_avx2(const int128 *a, int128 *out, std::size_t n) noexcept {
+            const __m256i zero = _mm256_setzero_si256();
+            std::size_t i = 0;
+            for (; i + 2 <= n; i += 2) {
+                const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+                const __m256i borrow = _mm256_xor_si256(_mm256_cmpeq_epi64(va, zero), _mm256_set1_epi64x(-1));
+                const __m256i r = _mm256_add_epi64(_mm256_sub_epi64(zero, va), _mm256_bsrli_epi128(borrow, 8));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), r);
+            }
+            negate_scalar(a + i, out + i, n - i);
+        }
+
+        __attribute__((target("avx2")))
+        inline void cmp_avx2(const int128 *a, const int128 *b, std::int8_t *out, std::size_t n) noexcept {
+            const __m256i sb = _mm256_set1_epi64x(std::numeric_limits<std::int64_t>::min());
+            std::size_t i = 0;
+            for (; i + 2 <= n; i += 2) {
+                const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+                const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+                const __m256i ax = _mm256_xor_si256(va, sb);
+                const __m256i bx = _mm256_xor_si256(vb, sb);
+                const __m256i eq = _mm256_cmpeq_epi64(va, vb);
+                // qword 0 compares the signed high words, qword 1 the unsigned low words.
+                const __m256i gt_hi = _mm256_cmpgt_epi64(va, vb);
+                const __m256i lt_hi = _mm256_cmpgt_epi64(vb, va);
+                const __m256i gt_lo = _mm256_bsrli_epi128(_mm256_cmpgt_epi64(ax, bx), 8);
+                const __m256i lt_lo = _mm256_bsrli_epi128(_mm256_cmpgt_epi64(bx, ax), 8);
+                const int gt = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_or_si256(gt_hi, _mm256_and_si256(eq, gt_lo))));
+                const int lt = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_or_si256(lt_hi, _mm256_and_si256(eq, lt_lo))));
+                out[i] = static_cast<std::int8_t>((gt & 1) - (lt & 1));
+                out[i + 1] = static_cast<std::int8_t>(((gt >> 2) & 1) - ((lt >> 2) & 1));
+            }
+            cmp_scalar(a + i, b + i, out + i, n - i);
+        }
+
+        // Compacts the even bits of an 8-lane mask (one per 128-bit row) into the low four bits.
+        constexpr unsigned even_lanes(unsigned k) noexcept {
+            return (k & 1U) | ((k >> 1) & 2U) | ((k >> 2) & 4U) | ((k >> 3) & 8U);
+        }
+
+        template<bool Sub>
+        __attribute__((target("avx512f")))
+        std::uint64_t add_sub_block_avx512(const int128 *a, const int128 *b, int128 *out, std::size_t n,
+                                           const raw_bounds &bd) noexcept {
+            constexpr __mmask8 lo_lanes = 0xAA;
+            const __m512i one = _mm512_set1_epi64(1);
+            const __m512i bias = _mm512_set_epi64(
+                static_cast<long long>(bd.bias.low()), static_cast<long long>(bd.bias.high()),
+                static_cast<long long>(bd.bias.low()), static_cast<long long>(bd.bias.high()),
+                static_cast<long long>(bd.bias.low()), static_cast<long long>(bd.bias.high()),
+                static_cast<long long>(bd.bias.low()), static_cast<long long>(bd.bias.high()));
+            const __m512i lim = _mm512_set_epi64(
+                static_cast<long long>(bd.limit.low()), static_cast<long long>(bd.limit.high()),
+                static_cast<long long>(bd.limit.low()), static_cast<long long>(bd.limit.high()),
+                static_cast<long long>(bd.limit.low()), static_cast<long long>(bd.limit.high()),
+                static_cast<long long>(bd.limit.low()), static_cast<long long>(bd.limit.high()));
+
+            std::uint64_t m = 0;
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                const __m512i va = _mm512_loadu_si512(a + i);
+                const __m512i vb = _mm512_loadu_si512(b + i);
+                __m512i r;
+                if constexpr (Sub) {
+                    const __m512i d = _mm512_sub_epi64(va, vb);
+                    const __mmask8 borrow = _mm512_cmplt_epu64_mask(va, vb) & lo_lanes;
+                    r = _mm512_mask_sub_epi64(d, static_cast<__mmask8>(borrow >> 1), d, one);
+                } else {
+                    const __m512i sum = _mm512_add_epi64(va, vb);
+                    const __mmask8 carry = _mm512_cmplt_epu64_mask(sum, va) & lo_lanes;
+                    r = _mm512_mask_add_epi64(sum, static_cast<__mmask8>(carry >> 1), sum, one);
+                }
+                _mm512_storeu_si512(out + i, r);
+
+                __m512i u = _mm512_add_epi64(r, bias);
+                const __mmask8 c = _mm512_cmplt_epu64_mask(u, r) & lo_lanes;
+                u = _mm512_mask_add_epi64(u, static_cast<__mmask8>(c >> 1), u, one);
+                const unsigned gt = _mm512_cmpgt_epu64_mask(u, lim);
+                const unsigned eq = _mm512_cmpeq_epu64_mask(u, lim);
+                m |= static_cast<std::uint64_t>(even_lanes(gt | (eq & (gt >> 1)))) << i;
+            }
+            if (i < n) m |= add_sub_block_avx2<Sub>(a + i, b + i, out + i, n - i, bd) << i;
+            return m;
+        }
+
+        __attribute__((target("avx512f")))
+        inline void negate_avx512(const int128 *a, int128 *out, std::size_t n) noexcept {
+            constexpr __mmask8 lo_lanes = 0xAA;
+            const __m512i zero = _mm512_setzero_si512();
+            const __m512i one = _mm512_set1_epi64(1);
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                const __m512i va = _mm512_loadu_si512(a + i);
+                const __m512i d = _mm512_sub_epi64(zero, va);
+                const __mmask8 borrow = _mm512_test_epi64_mask(va, va) & lo_lanes;
+                _mm512_storeu_si512(out + i, _mm512_mask_sub_epi64(d, static_cast<__mmask8>(borrow >> 1), d, one));
+            }
+            negate_avx2(a + i, out + i, n - i);
+        }
+
+        __attribute__((target("avx512f")))
+        inline void cmp_avx512(const int128 *a, const int128 *b, std::int8_t *out, std::size_t n) noexcept {
+            constexpr unsigned hi_lanes = 0x55;
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                const __m512i va = _mm512_loadu_si512(a + i);
+                const __m512i vb = _mm512_loadu_si512(b + i);
+                const unsigned eq = _mm512_cmpeq_epi64_mask(va, vb);
+                const unsigned gt_lo = _mm512_cmpgt_epu64_mask(va, vb) >> 1;
+                const unsigned lt_lo = _mm512_cmplt_epu64_mask(va, vb) >> 1;
+                const unsigned gt = even_lanes((_mm512_cmpgt_epi64_mask(va, vb) | (eq & gt_lo)) & hi_lanes);
+                const unsigned lt = even_lanes((_mm512_cmplt_epi64_mask(va, vb) | (eq & lt_lo)) & hi_lanes);
+                for (unsigned k = 0; k < 4; ++k) {
+                    out[i + k] = static_cast<std::int8_t>(static_cast<int>((gt >> k) & 1U) - static_cast<int>((lt >> k) & 1U));
+                }
+            }
+            cmp_avx2(a + i, b + i, out + i, n - i);
+        }
+#endif
+
+        enum class Isa : std::uint8_t {
+            Scalar,
+            Avx2,
+            Avx512,
+        };
+
+        inline Isa detect_isa() noexcept {
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f")) return Isa::Avx512;
+            if (__builtin_cpu_supports("avx2")) return Isa::Avx2;
+#endif
+            return Isa::Scalar;
+        }
+
+        // Whether this CPU can run the kernels of isa, independent of which one active_isa() picked.
+        inline bool isa_supported(Isa isa) noexcept {
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+            __builtin_cpu_init();
+            if (isa == Isa::Avx512) return __builtin_cpu_supports("avx512f");
+            if (isa == Isa::Avx2) return __builtin_cpu_supports("avx2");
+#endif
+            return isa == Isa::Scalar;
+        }
+
+        inline Isa active_isa() noexcept {
+            static const Isa isa = detect_isa();
+            return isa;
+        }
+
+        struct column_kernels {
+            add_sub_block_fn add;
+            add_sub_block_fn sub;
+            negate_fn negate;
+            cmp_fn cmp;
+        };
+
+        inline const column_kernels &kernels_for(Isa isa) noexcept {
+            static constexpr column_kernels scalar{
+                add_sub_block_scalar<false>, add_sub_block_scalar<true>, negate_scalar, cmp_scalar};
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+            static constexpr column_kernels avx2{
+                add_sub_block_avx2<false>, add_sub_block_avx2<true>, negate_avx2, cmp_avx2};
+            static constexpr column_kernels avx512{
+                add_sub_block_avx512<false>, add_sub_block_avx512<true>, negate_avx512, cmp_avx512};
+            if (isa == Isa::Avx512) return avx512;
+            if (isa == Isa::Avx2) return avx2;
+#endif
+            (void) isa;
+            return scalar;
+        }
+
+        inline std::size_t run_add_sub(add_sub_block_fn fn, std::span<const int128> a, std::span<const int128> b,
+                                       std::span<int128> out, std::span<std::uint64_t> overflow,
+                                       const raw_bounds &bd) noexcept {
+            const std::size_t n = std::min({a.size(), b.size(), out.size(), overflow.size() * 64});
+            std::size_t flagged = 0;
+            for (std::size_t base = 0; base < n; base += 64) {
+                const std::size_t len = std::min<std::size_t>(64, n - base);
+                const std::uint64_t m = fn(a.data() + base, b.data() + base, out.data() + base, len, bd);
+                overflow[base / 64] = m;
+                flagged += static_cast<std::size_t>(std::popcount(m));
+            }
+            return flagged;
+        }
+    } // namespace detail
+
+    // Raw int128 column kernels. Inputs are Numeric128<P,S> raw values; bit i of overflow is set when row i
+    // leaves the P-digit range (out[i] then holds the wrapped raw sum). Each returns the number of flagged
+    // rows. The implementation is picked once per process from the CPU (AVX-512F, AVX2 or scalar).
+    namespace kernels {
+        template<int P>
+        std::size_t add(std::span<const int128> a, std::span<const int128> b, std::span<int128> out,
+                        std::span<std::uint64_t> overflow) noexcept {
+            return detail::run_add_sub(detail::kernels_for(detail::active_isa()).add, a, b, out, overflow,
+                                       detail::raw_bounds_for<P>);
+        }
+
+        template<int P>
+        std::size_t sub(std::span<const int128> a, std::span<const int128> b, std::span<int128> out,
+                        std::span<std::uint64_t> overflow) noexcept {
+            return detail::run_add_sub(detail::kernels_for(detail::active_isa()).sub, a, b, out, overflow,
+                                       detail::raw_bounds_for<P>);
+        }
+
+        // Negation cannot leave the symmetric P-digit range, so there is no overflow mask.
+        inline void negate(std::span<const int128> a, std::span<int128> out) noexcept {
+            detail::kernels_for(detail::active_isa()).negate(a.data(), out.data(), std::min(a.size(), out.size()));
+        }
+
+        inline void cmp(std::span<const int128> a, std::span<const int128> b, std::span<std::int8_t> out) noexcept {
+            detail::kernels_for(detail::active_isa()).cmp(a.data(), b.data(), out.data(),
+                                                          std::min({a.size(), b.size(), out.size()}));
+        }
+    } // namespace kernels
+
+    // Structure-of-arrays storage for Numeric128<P,S>: a 16-byte aligned int128 array plus a packed 2-bit
+    // status per row. Error rows keep raw == 0, like Numeric128 itself.
+    template<int P, int S>
+    class Numeric128Column {
+    public:
+        using value_type = Numeric128<P, S>;
+        using self = Numeric128Column<P, S>;
+        using raw_allocator = detail::aligned_allocator<int128, 16>;
+
+        Numeric128Column() = default;
+
+        explicit Numeric128Column(std::size_t n) { resize(n); }
+
+        explicit Numeric128Column(std::span<const value_type> values) {
+            reserve(values.size());
+            for (const auto &v: values) push_back(v);
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept { return raw_.size(); }
+        [[nodiscard]] bool empty() const noexcept { return raw_.empty(); }
+
+        void reserve(std::size_t n) {
+            raw_.reserve(n);
+            status_.reserve(words_for_(n));
+        }
+
+        void resize(std::size_t n) {
+            const std::size_t old = size();
+            raw_.resize(n);
+            status_.resize(words_for_(n), 0);
+            if (n < old && n % detail::status_rows_per_word != 0) {
+                status_.back() &= (std::uint64_t{1} << (2 * (n % detail::status_rows_per_word))) - 1;
+            }
+        }
+
+        void clear() noexcept {
+            raw_.clear();
+            status_.clear();
+        }
+
+        void push_back(const value_type &v) {
+            const std::size_t i = size();
+            resize(i + 1);
+            set(i, v);
+        }
+
+        [[nodiscard]] value_type operator[](std::size_t i) const noexcept {
+            value_type v;
+            v.raw_ = raw_[i];
+            v.err_ = error(i);
+            return v;
+        }
+
+        void set(std::size_t i, const value_type &v) noexcept {
+            raw_[i] = v.ok() ? v.raw_ : int128{0};
+            set_error_(i, v.err_);
+        }
+
+        [[nodiscard]] int128 raw(std::size_t i) const noexcept { return raw_[i]; }
+
+        [[nodiscard]] Err error(std::size_t i) const noexcept {
+            const std::size_t shift = 2 * (i % detail::status_rows_per_word);
+            return static_cast<Err>((status_[i / detail::status_rows_per_word] >> shift) & 3U);
+        }
+
+        [[nodiscard]] bool ok(std::size_t i) const noexcept { return error(i) == Err::None; }
+
+        [[nodiscard]] std::size_t error_count() const noexcept {
+            std::size_t n = 0;
+            for (std::uint64_t w: status_) n += static_cast<std::size_t>(std::popcount((w | (w >> 1)) & detail::status_lo_bits));
+            return n;
+        }
+
+        [[nodiscard]] std::span<const int128> raw_data() const noexcept { return raw_; }
+        [[nodiscard]] std::span<const std::uint64_t> status_data() const noexcept { return status_; }
+
+        static void add(const self &a, const self &b, self &out) {
+            add_sub_<false>(a, b, out);
+        }
+
+        static void sub(const self &a, const self &b, self &out) {
+            add_sub_<true>(a, b, out);
+        }
+
+        static void mul(const self &a, const self &b, self &out, Rounding rnd = Rounding::HalfUp) {
+            const std::size_t n = prepare_(a, b, out);
+            for (std::size_t i = 0; i < n; ++i) out.set(i, value_type::mul(a[i], b[i], rnd));
+        }
+
+        static void div(const self &a, const self &b, self &out, Rounding rnd = Rounding::HalfUp) {
+            const std::size_t n = prepare_(a, b, out);
+            for (std::size_t i = 0; i < n; ++i) out.set(i, value_type::div(a[i], b[i], rnd));
+        }
+
+        // out[i] = -1, 0 or 1 by raw value; error rows compare as zero.
+        static void compare(const self &a, const self &b, std::span<std::int8_t> out) noexcept {
+            kernels::cmp(a.raw_, b.raw_, out);
+        }
+
+    private:
+        std::vector<int128, raw_allocator> raw_;
+        std::vector<std::uint64_t> status_;
+
+        static std::size_t words_for_(std::size_t n) noexcept {
+            return (n + detail::status_rows_per_word - 1) / detail::status_rows_per_word;
+        }
+
+        void set_error_(std::size_t i, Err e) noexcept {
+            const std::size_t shift = 2 * (i % detail::status_rows_per_word);
+            std::uint64_t &w = status_[i / detail::status_rows_per_word];
+            w = (w & ~(std::uint64_t{3} << shift)) | (std::uint64_t(e) << shift);
+        }
+
+        static std::size_t prepare_(const self &a, const self &b, self &out) {
+            const std::size_t n = std::min(a.size(), b.size());
+            out.resize(n);
+            return n;
+        }
+
+        template<bool Sub>
+        static void add_sub_(const self &a, const self &b, self &out) {
+            const std::size_t n = prepare_(a, b, out);
+            const auto &k = detail::kernels_for(detail::active_isa());
+            const detail::add_sub_block_fn fn = Sub ? k.sub : k.add;
+            constexpr std::size_t rows = detail::status_rows_per_word;
+
+            for (std::size_t w = 0; w < out.status_.size(); ++w) {
+                const std::size_t base = w * rows;
+                const std::size_t len = std::min(rows, n - base);
+                const std::uint64_t ovf = detail::spread_row_mask(static_cast<std::uint32_t>(
+                    fn(a.raw_.data() + base, b.raw_.data() + base, out.raw_.data() + base, len,
+                       detail::raw_bounds_for<P>)));
+
+                std::uint64_t st = detail::merge_status(a.status_[w], b.status_[w]);
+                if (len < rows) st &= (std::uint64_t{1} << (2 * len)) - 1;
+                const std::uint64_t in_err = (st | (st >> 1)) & detail::status_lo_bits;
+                const std::uint64_t new_ovf = ovf & ~in_err;
+                st |= new_ovf << 1;
+                out.status_[w] = st;
+
+                for (std::uint64_t bad = in_err | new_ovf; bad != 0; bad &= bad - 1) {
+                    out.raw_[base + static_cast<std::size_t>(std::countr_zero(bad)) / 2] = int128{0};
+                }
+            }
+        }
+    };
+} // namespace usub::umath
+
+#endif // UNUMBER_NUMERIC_COLUMN_H
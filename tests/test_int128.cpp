@@ -110,6 +110,38 @@ TEST(UInt128, ToStringSamples) {
     EXPECT_EQ(umax.to_string(), "340282366920938463463374607431768211455");
 }
 
+TEST(UInt128, ToCharsChunkBoundaries) {
+    EXPECT_EQ(U(0, 9'999'999'999'999'999'999ull).to_string(), "9999999999999999999");
+    EXPECT_EQ(U(0, 10'000'000'000'000'000'000ull).to_string(), "10000000000000000000");
+    EXPECT_EQ(U(0, ~0ull).to_string(), "18446744073709551615");
+    EXPECT_EQ((U(0, 10'000'000'000'000'000'000ull) * U(0, 10'000'000'000'000'000'000ull)).to_string(),
+              "100000000000000000000000000000000000000");
+    EXPECT_EQ((U(0, 10'000'000'000'000'000'000ull) * U(0, 10'000'000'000'000'000'000ull) - U(0, 1)).to_string(),
+              std::string(38, '9'));
+}
+
+TEST(UInt128, ToCharsBufferTooSmall) {
+    const auto umax = (std::numeric_limits<uint128>::max)();
+    char buf[uint128::max_chars];
+
+    auto res = umax.to_chars(buf, buf + uint128::max_chars);
+    EXPECT_EQ(res.ec, std::errc{});
+    EXPECT_EQ(std::string(buf, res.ptr), umax.to_string());
+
+    res = umax.to_chars(buf, buf + uint128::max_chars - 1);
+    EXPECT_EQ(res.ec, std::errc::value_too_large);
+    EXPECT_EQ(res.ptr, buf + uint128::max_chars - 1);
+
+    const auto imin = (std::numeric_limits<int128>::min)();
+    char ibuf[int128::max_chars];
+    auto ires = imin.to_chars(ibuf, ibuf + int128::max_chars);
+    EXPECT_EQ(ires.ec, std::errc{});
+    EXPECT_EQ(std::string(ibuf, ires.ptr), "-170141183460469231731687303715884105728");
+
+    ires = imin.to_chars(ibuf, ibuf);
+    EXPECT_EQ(ires.ec, std::errc::value_too_large);
+}
+
 TEST(Int128, BasicArith) {
     int128 p{100};
     int128 n{-30};
@@ -136,6 +168,35 @@ TEST(Int128, UnaryMinus) {
     EXPECT_EQ((-int128{-1}).to_string(), "1");
 }
 
+TEST(Int128, SignedOrdering) {
+    const auto imin = (std::numeric_limits<int128>::min)();
+    const auto imax = (std::numeric_limits<int128>::max)();
+
+    // Negative values have the top bit of the high limb set; they must still sort below positive ones.
+    EXPECT_LT(int128{-1}, int128{1});
+    EXPECT_LT(int128{-1}, int128{0});
+    EXPECT_GT(S(0, 1), S(-1, ~0ULL));
+    EXPECT_LT(S(-5, 0), S(3, 0));
+    EXPECT_LT(imin, int128{0});
+    EXPECT_LT(imin, imax);
+    EXPECT_LT(int128{-1}, imax);
+    EXPECT_GT(int128{0}, imin);
+    EXPECT_EQ(imin <=> imin, std::strong_ordering::equal);
+
+    // Equal high limbs: the low limb decides, as an unsigned value, for either sign.
+    EXPECT_LT(S(7, 1), S(7, 2));
+    EXPECT_LT(S(7, 0x7FFFFFFFFFFFFFFFULL), S(7, 0x8000000000000000ULL));
+    EXPECT_LT(S(-7, 1), S(-7, ~0ULL));
+    EXPECT_LT(S(-1, 0), S(-1, ~0ULL));
+
+    std::vector<int128> v = {imax, int128{0}, S(-1, 0), imin, int128{-1}, S(1, 0), int128{1}};
+    std::ranges::sort(v);
+    const std::vector<int128> sorted = {imin, S(-1, 0), int128{-1}, int128{0}, int128{1}, S(1, 0), imax};
+    EXPECT_EQ(v, sorted);
+    EXPECT_EQ(std::ranges::min(v), imin);
+    EXPECT_EQ(std::ranges::max(v), imax);
+}
+
 #if defined(__SIZEOF_INT128__)
 TEST(UInt128, RandomAgainstBuiltin) {
     std::mt19937_64 rng(123);
@@ -182,6 +243,8 @@ TEST(Int128, RandomAgainstBuiltin) {
         EXPECT_EQ(to_wide(a + b), wa + wb);
         EXPECT_EQ(to_wide(a - b), wa - wb);
         EXPECT_EQ(to_wide(a * b), wa * wb);
+        EXPECT_EQ(a < b, wa < wb);
+        EXPECT_EQ(a > b, wa > wb);
 
         if (!(bhi == 0 && blo == 0)) {
             EXPECT_EQ(to_wide(a / b), wa / wb);
@@ -183,6 +183,48 @@ TEST(UInt256, ToStringSamples) {
               "115792089237316195423570985008687907853269984665640564039457584007913129639935");
 }
 
+TEST(UInt256, ToStringMatchesDigitByDigit) {
+    std::mt19937_64 rng(31337);
+    const uint256 ten{10u};
+
+    for (int i = 0; i < 2000; ++i) {
+        const int limbs = 1 + static_cast<int>(rng() % 4);
+        std::uint64_t w[4] = {rng(), rng(), rng(), rng()};
+        for (int k = limbs; k < 4; ++k) w[k] = 0;
+        const uint256 v = U256(U128(w[3], w[2]), U128(w[1], w[0]));
+
+        std::string expected;
+        uint256 t = v;
+        do {
+            expected.push_back(static_cast<char>('0' + static_cast<unsigned>(static_cast<std::uint64_t>(t % ten))));
+            t /= ten;
+        } while (t != uint256{0u});
+        std::reverse(expected.begin(), expected.end());
+
+        ASSERT_EQ(v.to_string(), expected);
+        ASSERT_EQ(int256{v}.to_string(), int256{v}.is_negative() ? "-" + (-int256{v}).to_string() : expected);
+    }
+}
+
+TEST(Int256, ToCharsLimits) {
+    const int256 imin = S256(uint128{0x8000'0000'0000'0000ull, 0}, uint128{0, 0});
+    char buf[int256::max_chars];
+
+    auto res = imin.to_chars(buf, buf + int256::max_chars);
+    ASSERT_EQ(res.ec, std::errc{});
+    EXPECT_EQ(std::string(buf, res.ptr),
+              "-57896044618658097711785492504343953926634992332820282019728792003956564819968");
+
+    res = imin.to_chars(buf, buf + 10);
+    EXPECT_EQ(res.ec, std::errc::value_too_large);
+
+    const auto umax = (std::numeric_limits<uint256>::max)();
+    char ubuf[uint256::max_chars];
+    auto ures = umax.to_chars(ubuf, ubuf + uint256::max_chars);
+    ASSERT_EQ(ures.ec, std::errc{});
+    EXPECT_EQ(static_cast<std::size_t>(ures.ptr - ubuf), uint256::max_chars);
+}
+
 TEST(Int256, BasicArith) {
     int256 p{100};
     int256 n{-30};
@@ -226,6 +268,69 @@ TEST(UInt256, DivModIdentityRandom) {
     }
 }
 
+static void div_mod_bitwise(uint256 a, uint256 b, uint256 &q, uint256 &r) {
+    q = uint256{0u};
+    r = uint256{0u};
+    for (int i = 255; i >= 0; --i) {
+        r = (r << 1) | ((a >> i) & uint256{1u});
+        if (r >= b) {
+            r -= b;
+            q = q | (uint256{1u} << i);
+        }
+    }
+}
+
+TEST(UInt256, DivModMatchesBitwiseByDivisorWidth) {
+    std::mt19937_64 rng(4242);
+
+    for (int i = 0; i < 4000; ++i) {
+        const uint256 a = U256(U128(rng(), rng()), U128(rng(), rng()));
+        const int limbs = 1 + static_cast<int>(rng() % 4);
+        const int drop = static_cast<int>(rng() % 64);
+
+        std::uint64_t w[4] = {rng(), rng(), rng(), rng()};
+        for (int k = limbs; k < 4; ++k) w[k] = 0;
+        w[limbs - 1] >>= drop;
+        if (w[limbs - 1] == 0) w[limbs - 1] = 1;
+
+        const uint256 b = U256(U128(w[3], w[2]), U128(w[1], w[0]));
+
+        uint256 q{}, r{};
+        uint256 eq{}, er{};
+        uint256::div_mod(a, b, q, r);
+        div_mod_bitwise(a, b, eq, er);
+
+        ASSERT_EQ(q, eq);
+        ASSERT_EQ(r, er);
+    }
+}
+
+TEST(UInt256, DivModQuotientEstimateCorrections) {
+    const auto umax = (std::numeric_limits<uint256>::max)();
+    const std::uint64_t top = 0x8000'0000'0000'0000ull;
+
+    const uint256 cases[][2] = {
+        {umax, U256(U128(0, 0), U128(top, 0))},
+        {umax, U256(U128(0, 0), U128(top, ~0ull))},
+        {umax, U256(U128(0, top), U128(0, 1))},
+        {U256(U128(top, 0), U128(0, 0)), U256(U128(0, 0), U128(top, 1))},
+        {U256(U128(0x7fff'ffff'ffff'ffffull, ~0ull), U128(0, 0)), U256(U128(0, 0), U128(top, ~0ull))},
+        {U256(U128(0, 0), U128(~0ull, ~0ull)), U256(U128(0, 0), U128(1, 0))},
+        {umax, uint256{10u}},
+        {umax, uint256{10'000'000'000'000'000'000ull}},
+        {umax, umax - uint256{1u}},
+    };
+
+    for (const auto &c: cases) {
+        uint256 q{}, r{};
+        uint256 eq{}, er{};
+        uint256::div_mod(c[0], c[1], q, r);
+        div_mod_bitwise(c[0], c[1], eq, er);
+        EXPECT_EQ(q, eq);
+        EXPECT_EQ(r, er);
+    }
+}
+
 TEST(Int256, DivModIdentityRandom) {
     std::mt19937_64 rng(888);
 
@@ -1,17 +1,23 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <cstdint>
 #include <cstdlib>
 #include <limits>
+#include <memory_resource>
 #include <random>
 #include <string>
 #include <string_view>
 #include <type_traits>
 #include <vector>
 
+#include "umath/Aggregate.h"
+#include "umath/Expression.h"
+#include "umath/GroupBy.h"
 #include "umath/Numeric.h"
+#include "umath/NumericColumn.h"
 #include "umath/ExtendedInt.h"
 
 using usub::umath::uint128;
@@ -23,6 +29,7 @@ using usub::umath::Err;
 using usub::umath::Numeric;
 using usub::umath::Numeric128;
 using usub::umath::Numeric256;
+using usub::umath::Numeric128Column;
 using usub::umath::Rounding;
 
 #if defined(__SIZEOF_INT128__)
@@ -130,6 +137,104 @@ TEST(Numeric128, ParseToStringBasics) {
     EXPECT_EQ(f.to_string(), "1.0000");
 }
 
+TEST(Numeric128, ParseLongFractionUsesGuardDigit) {
+    using N = Numeric128<38, 2>;
+
+    const std::string tail(80, '9');
+    N a("1.234" + tail, Rounding::Trunc);
+    ASSERT_TRUE(a.ok());
+    EXPECT_EQ(a.to_string(), "1.23");
+
+    N b("1.235" + tail, Rounding::HalfUp);
+    ASSERT_TRUE(b.ok());
+    EXPECT_EQ(b.to_string(), "1.24");
+
+    N c("-1.2349999", Rounding::HalfUp);
+    ASSERT_TRUE(c.ok());
+    EXPECT_EQ(c.to_string(), "-1.23");
+
+    using N0 = Numeric128<10, 0>;
+    EXPECT_EQ(N0("7.5").to_string(), "8");
+    EXPECT_EQ(N0("7.4999999999999999999999999999999999999999").to_string(), "7");
+
+    using N38 = Numeric128<38, 38>;
+    N38 d("0.12345678901234567890123456789012345678" "5");
+    ASSERT_TRUE(d.ok());
+    EXPECT_EQ(d.to_string(), "0.12345678901234567890123456789012345679");
+}
+
+TEST(Numeric128, PrecisionBoundIsExclusive) {
+    using N = Numeric128<38, 0>;
+    const std::string nines(38, '9');
+
+    EXPECT_TRUE(N(nines).ok());
+    EXPECT_TRUE(N("-" + nines).ok());
+    EXPECT_EQ(N("1" + std::string(38, '0')).error(), Err::Overflow);
+    EXPECT_EQ(N::from_raw_checked(int128(usub::umath::detail::pow10_u(38))).error(), Err::Overflow);
+}
+
+TEST(Numeric128, ParseChunkedDigitsMatchesScalar) {
+    using N = Numeric128<38, 12>;
+    std::mt19937_64 rng(0x5eed);
+
+    for (int iter = 0; iter < 20000; ++iter) {
+        const int int_len = static_cast<int>(rng() % 27);
+        const int frac_len = static_cast<int>(rng() % 30);
+        std::string s = (rng() & 1) ? "-" : "";
+        i128w int_ref = 0;
+        for (int i = 0; i < int_len; ++i) {
+            const int d = static_cast<int>(rng() % 10);
+            s.push_back(static_cast<char>('0' + d));
+            int_ref = int_ref * 10 + d;
+        }
+        i128w frac_ref = 0;
+        int guard = 0;
+        if (frac_len > 0) s.push_back('.');
+        for (int i = 0; i < frac_len; ++i) {
+            const int d = static_cast<int>(rng() % 10);
+            s.push_back(static_cast<char>('0' + d));
+            if (i < 12) frac_ref = frac_ref * 10 + d;
+            else if (i == 12) guard = d;
+        }
+        if (int_len == 0 && frac_len == 0) s.push_back('0');
+        if (frac_len < 12) frac_ref *= pow10_i128(12 - frac_len);
+
+        i128w expect = int_ref * pow10_i128(12) + frac_ref + (guard >= 5 ? 1 : 0);
+        if (!s.empty() && s[0] == '-') expect = -expect;
+
+        N v(s);
+        ASSERT_TRUE(v.ok()) << s;
+        EXPECT_EQ(v.to_string(), to_fixed_string_i128(expect, 12)) << s;
+    }
+}
+
+TEST(Numeric128, ParseRejectsBadDigitInAnyChunkPosition) {
+    using N = Numeric128<38, 10>;
+    const std::string base = "1234567890123456789012345678.1234567890123";
+    for (std::size_t i = 0; i < base.size(); ++i) {
+        if (base[i] == '.') continue;
+        for (char bad: {'/', ':', 'a', ' ', '\x80'}) {
+            std::string s = base;
+            s[i] = bad;
+            N v(s);
+            EXPECT_FALSE(v.ok()) << s;
+            EXPECT_EQ(v.error(), Err::Invalid) << s;
+        }
+    }
+    EXPECT_TRUE(N(base).ok());
+}
+
+TEST(Numeric128, ParseLongIntegerPartOverflowsInsteadOfWrapping) {
+    using N = Numeric128<38, 0>;
+    EXPECT_TRUE(N(std::string(38, '9')).ok());
+    EXPECT_TRUE(N("000000000000000000000000000000000000000000001").ok());
+
+    const std::string big = "1" + std::string(39, '0');
+    EXPECT_EQ(N(big).error(), Err::Overflow);
+    EXPECT_EQ(N("340282366920938463463374607431768211457").error(), Err::Overflow);
+    EXPECT_EQ(N(big + "x").error(), Err::Invalid);
+}
+
 TEST(Numeric128, InvalidAndDivByZero) {
     using N = Numeric128<20, 2>;
 
@@ -252,6 +357,31 @@ TEST(Numeric128, RandomAgainstBuiltinScaled) {
 }
 #endif
 
+TEST(Pow10Division, MatchesGenericDivision) {
+    namespace d = usub::umath::detail;
+    std::mt19937_64 rng(9090);
+
+    for (int i = 0; i < 20000; ++i) {
+        const uint128 n128{rng() >> (rng() % 64), rng()};
+        const auto k128 = static_cast<unsigned>(rng() % 39);
+        const uint128 p128 = d::pow10_u(k128);
+
+        uint128 r128{};
+        const uint128 q128 = d::div_pow10_u(n128, k128, r128);
+        ASSERT_EQ(q128, n128 / p128);
+        ASSERT_EQ(r128, n128 % p128);
+
+        const uint256 n256{uint128{rng(), rng()}, uint128{rng(), rng()}};
+        const auto k256 = static_cast<unsigned>(rng() % 78);
+        const uint256 p256 = d::pow10_u256(k256);
+
+        uint256 r256{};
+        const uint256 q256 = d::div_pow10_u256(n256, k256, r256);
+        ASSERT_EQ(q256, n256 / p256);
+        ASSERT_EQ(r256, n256 % p256);
+    }
+}
+
 TEST(Numeric256, ParseToStringBasics) {
     using N = Numeric256<76, 4>;
 
@@ -801,3 +931,1098 @@ TEST(Numeric256, DivHalfUpRoundsAwayFromZero) {
     ASSERT_TRUE(y.ok());
     EXPECT_EQ(y.to_string(), "-0.1");
 }
+
+TEST(Numeric128, ToCharsFromChars) {
+    using N = Numeric128<38, 4>;
+    static_assert(N::max_chars == 1 + 34 + 1 + 4);
+
+    for (const char *s : {"0.0000", "-1.2345", "123456.7890", "-9999999999999999999999999999999999.9999"}) {
+        N v(s);
+        ASSERT_TRUE(v.ok()) << s;
+        char buf[N::max_chars];
+        const auto r = v.to_chars(buf, buf + sizeof(buf));
+        ASSERT_EQ(r.ec, std::errc{});
+        EXPECT_EQ(std::string(buf, r.ptr), v.to_string());
+        EXPECT_EQ(std::string(buf, r.ptr), s);
+
+        N back;
+        const auto pr = from_chars(buf, r.ptr, back);
+        EXPECT_EQ(pr.ec, std::errc{});
+        EXPECT_EQ(pr.ptr, r.ptr);
+        EXPECT_EQ(back, v);
+    }
+
+    char small[4];
+    EXPECT_EQ(N("12.5").to_chars(small, small + sizeof(small)).ec, std::errc::value_too_large);
+    EXPECT_EQ((*N::from_raw_checked(int128(1))).to_chars(small, small + sizeof(small)).ec, std::errc::value_too_large);
+    EXPECT_EQ(N("x").to_chars(small, small + sizeof(small)).ec, std::errc::invalid_argument);
+
+    const std::string_view in = "12.5,rest";
+    N v;
+    auto r = from_chars(in.data(), in.data() + in.size(), v);
+    EXPECT_EQ(r.ec, std::errc{});
+    EXPECT_EQ(r.ptr, in.data() + 4);
+    EXPECT_EQ(v.to_string(), "12.5000");
+
+    const std::string_view none = "abc";
+    r = from_chars(none.data(), none.data() + none.size(), v);
+    EXPECT_EQ(r.ec, std::errc::invalid_argument);
+    EXPECT_EQ(r.ptr, none.data());
+    EXPECT_EQ(v.to_string(), "12.5000");
+
+    using Small = Numeric128<5, 2>;
+    Small s("1.00");
+    const std::string_view big = "1000.00";
+    r = from_chars(big.data(), big.data() + big.size(), s);
+    EXPECT_EQ(r.ec, std::errc::result_out_of_range);
+    EXPECT_EQ(r.ptr, big.data() + big.size());
+    EXPECT_EQ(s.to_string(), "1.00");
+}
+
+TEST(Numeric256, ToCharsFromChars) {
+    using N = Numeric256<76, 6>;
+    for (const char *s : {"0.000000", "-0.000001", "12345678901234567890123456789012345678901234567890.123456"}) {
+        N v(s);
+        ASSERT_TRUE(v.ok()) << s;
+        char buf[N::max_chars];
+        const auto r = v.to_chars(buf, buf + sizeof(buf));
+        ASSERT_EQ(r.ec, std::errc{});
+        EXPECT_EQ(std::string(buf, r.ptr), s);
+
+        N back;
+        EXPECT_EQ(from_chars(buf, r.ptr, back).ec, std::errc{});
+        EXPECT_EQ(back, v);
+    }
+}
+
+TEST(Numeric, ToCharsFromChars) {
+    for (const char *s : {"0", "7", "-0.05", "0.000123", "-123456789012345678901234567890.5", "1000000000"}) {
+        Numeric v(s);
+        ASSERT_TRUE(v.ok()) << s;
+        std::string buf(Numeric::max_chars, '\0');
+        const auto r = v.to_chars(buf.data(), buf.data() + buf.size());
+        ASSERT_EQ(r.ec, std::errc{});
+        EXPECT_EQ(std::string(buf.data(), r.ptr), v.to_string());
+        EXPECT_EQ(std::string(buf.data(), r.ptr), s);
+
+        Numeric back;
+        EXPECT_EQ(from_chars(buf.data(), r.ptr, back).ec, std::errc{});
+        EXPECT_EQ(back.to_string(), s);
+
+        char tiny[2];
+        if (std::string_view(s).size() > 2) {
+            EXPECT_EQ(v.to_chars(tiny, tiny + 2).ec, std::errc::value_too_large);
+        }
+    }
+}
+
+TEST(Numeric128, ParseBatch) {
+    using N = Numeric128<10, 2>;
+
+    const std::vector<std::string_view> in = {"1.5", "-0.005", "x", "123456789.00", "42"};
+    std::vector<N> out(in.size());
+    std::vector<Err> err(in.size());
+    const auto r = N::parse_batch(in, out, err);
+    EXPECT_EQ(r.parsed, in.size());
+    EXPECT_EQ(r.failed, 2u);
+    EXPECT_EQ(out[0].to_string(), "1.50");
+    EXPECT_EQ(out[1].to_string(), "-0.01");
+    EXPECT_EQ(err[2], Err::Invalid);
+    EXPECT_EQ(err[3], Err::Overflow);
+    EXPECT_EQ(err[4], Err::None);
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        EXPECT_EQ(out[i].error(), N(in[i]).error());
+        if (out[i].ok()) {
+            EXPECT_EQ(out[i], N(in[i]));
+        }
+    }
+
+    const std::string_view buf = "1.5-0.005x123456789.0042";
+    const std::vector<std::uint32_t> offsets = {0, 3, 9, 10, 22, 24};
+    std::vector<N> out2(in.size());
+    EXPECT_EQ(N::parse_batch(buf, offsets, std::span<N>(out2)).failed, 2u);
+    for (std::size_t i = 0; i < in.size(); ++i) EXPECT_EQ(out2[i].error(), out[i].error());
+    EXPECT_EQ(out2[4].to_string(), "42.00");
+
+    // Offsets past the buffer or out of order mark only their own field.
+    const std::vector<int> bad_offsets = {0, 3, 2, 9, 40};
+    std::vector<Err> err2(4, Err::DivByZero);
+    const auto rb = N::parse_batch(buf, bad_offsets, std::span<N>(out2), std::span<Err>(err2).first(2));
+    EXPECT_EQ(rb.parsed, 4u);
+    EXPECT_EQ(rb.failed, 3u);
+    EXPECT_EQ(out2[0].to_string(), "1.50");
+    EXPECT_EQ(out2[1].error(), Err::Invalid);
+    EXPECT_EQ(out2[3].error(), Err::Invalid);
+    EXPECT_EQ(err2[1], Err::Invalid);
+    EXPECT_EQ(err2[2], Err::DivByZero);
+
+    const std::string_view csv = "1.5\n-0.005\nx\n123456789.00\n42\n";
+    std::vector<N> out3(8);
+    std::vector<Err> err3(8, Err::DivByZero);
+    const auto r3 = N::parse_batch(csv, '\n', out3, err3, Rounding::Trunc);
+    EXPECT_EQ(r3.parsed, 5u);
+    EXPECT_EQ(r3.failed, 2u);
+    EXPECT_EQ(out3[1].to_string(), "0.00");
+    EXPECT_EQ(err3[2], Err::Invalid);
+    EXPECT_EQ(err3[4], Err::None);
+    EXPECT_EQ(err3[5], Err::DivByZero);
+
+    std::vector<N> two(2);
+    EXPECT_EQ(N::parse_batch(csv, '\n', two).parsed, 2u);
+    EXPECT_EQ(two[1].to_string(), "-0.01");
+}
+
+TEST(Numeric128Column, StorageAndStatusBits) {
+    using N = Numeric128<10, 2>;
+    using C = Numeric128Column<10, 2>;
+
+    C col;
+    for (int i = 0; i < 70; ++i) col.push_back(i % 7 == 3 ? N("bad") : N(std::int64_t{i}));
+    ASSERT_EQ(col.size(), 70u);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(col.raw_data().data()) % 16, 0u);
+    EXPECT_EQ(col.status_data().size(), 3u);
+    EXPECT_EQ(col.error_count(), 10u);
+
+    for (std::size_t i = 0; i < col.size(); ++i) {
+        if (i % 7 == 3) {
+            EXPECT_EQ(col.error(i), Err::Invalid);
+            EXPECT_EQ(col.raw(i), int128{0});
+        } else {
+            EXPECT_TRUE(col.ok(i));
+            EXPECT_EQ(col[i], N(static_cast<std::int64_t>(i)));
+        }
+    }
+
+    col.set(3, N("1.25"));
+    EXPECT_EQ(col[3].to_string(), "1.25");
+    col.resize(33);
+    EXPECT_EQ(col.error_count(), 4u);
+    col.resize(64);
+    EXPECT_TRUE(col.ok(40));
+    EXPECT_EQ(col.raw(40), int128{0});
+}
+
+TEST(Numeric128Column, KernelsMatchScalar) {
+    using N = Numeric128<6, 2>;
+    using C = Numeric128Column<6, 2>;
+    std::mt19937_64 rng(77);
+
+    std::vector<N> av, bv;
+    for (int i = 0; i < 200; ++i) {
+        auto pick = [&]() -> N {
+            const auto r = rng() % 20;
+            if (r == 0) return N("x");
+            if (r == 1) return N(std::int64_t{0});
+            return N(to_fixed_string_i128(static_cast<i128w>(rng() % 1999999) - 999999, 2));
+        };
+        av.push_back(pick());
+        bv.push_back(pick());
+    }
+    const C a{std::span<const N>(av)};
+    const C b{std::span<const N>(bv.data(), 150)};
+
+    C sum, diff, prod, quot;
+    C::add(a, b, sum);
+    C::sub(a, b, diff);
+    C::mul(a, b, prod, Rounding::Trunc);
+    C::div(a, b, quot);
+    ASSERT_EQ(sum.size(), 150u);
+    std::vector<std::int8_t> cmp(150);
+    C::compare(a, b, cmp);
+
+    auto same = [](const N &x, const N &y) { return x.error() == y.error() && (!x.ok() || x == y); };
+    for (std::size_t i = 0; i < 150; ++i) {
+        EXPECT_TRUE(same(sum[i], N::add(av[i], bv[i]))) << i;
+        EXPECT_TRUE(same(diff[i], N::sub(av[i], bv[i]))) << i;
+        EXPECT_TRUE(same(prod[i], N::mul(av[i], bv[i], Rounding::Trunc))) << i;
+        EXPECT_TRUE(same(quot[i], N::div(av[i], bv[i], Rounding::HalfUp))) << i;
+        const auto o = a.raw(i) <=> b.raw(i);
+        EXPECT_EQ(cmp[i], o < 0 ? -1 : (o > 0 ? 1 : 0));
+    }
+    EXPECT_GT(sum.error_count(), 0u);
+
+    C self_sum = a;
+    C::add(self_sum, a, self_sum);
+    for (std::size_t i = 0; i < a.size(); ++i) EXPECT_TRUE(same(self_sum[i], N::add(av[i], av[i]))) << i;
+}
+
+TEST(ColumnKernels, EveryIsaMatchesScalar) {
+    namespace d = usub::umath::detail;
+    std::mt19937_64 rng(2024);
+
+    const i128w bound = pow10_i128(38);
+    auto edge = [&]() -> i128w {
+        switch (rng() % 8) {
+            case 0: return bound - 1;
+            case 1: return -(bound - 1);
+            case 2: return 0;
+            case 3: return static_cast<i128w>(rng() % 3) - 1;
+            case 4: return static_cast<i128w>(static_cast<std::int64_t>(rng()));
+            case 5: return (static_cast<i128w>(rng() % 1000) << 64) - static_cast<i128w>(rng() % 3);
+            default: return static_cast<i128w>((static_cast<u128w>(rng()) << 64 | rng()) % static_cast<u128w>(bound)) *
+                            ((rng() & 1) ? 1 : -1);
+        }
+    };
+    auto to128 = [](i128w v) {
+        return int128(static_cast<std::int64_t>(static_cast<u128w>(v) >> 64), static_cast<std::uint64_t>(v));
+    };
+
+    const std::size_t n = 203;
+    std::vector<int128> a(n), b(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        a[i] = to128(edge());
+        b[i] = to128(edge());
+    }
+
+    const d::raw_bounds &bd38 = d::raw_bounds_for<38>;
+    const d::raw_bounds &bd4 = d::raw_bounds_for<4>;
+    const auto &ref = d::kernels_for(d::Isa::Scalar);
+
+    // Each kernel set the CPU can run is checked directly, not only the one the dispatcher picks.
+    for (d::Isa isa: {d::Isa::Avx2, d::Isa::Avx512}) {
+        if (!d::isa_supported(isa)) continue;
+        const auto &k = d::kernels_for(isa);
+        for (const d::raw_bounds *bd: {&bd38, &bd4}) {
+            for (std::size_t off = 0; off + 64 <= n; off += 61) {
+                for (std::size_t len: {std::size_t{1}, std::size_t{3}, std::size_t{64}}) {
+                    std::vector<int128> r0(len), r1(len);
+                    EXPECT_EQ(k.add(a.data() + off, b.data() + off, r1.data(), len, *bd),
+                              ref.add(a.data() + off, b.data() + off, r0.data(), len, *bd));
+                    EXPECT_EQ(r0, r1);
+                    EXPECT_EQ(k.sub(a.data() + off, b.data() + off, r1.data(), len, *bd),
+                              ref.sub(a.data() + off, b.data() + off, r0.data(), len, *bd));
+                    EXPECT_EQ(r0, r1);
+                }
+            }
+        }
+
+        std::vector<int128> n0(n), n1(n);
+        ref.negate(a.data(), n0.data(), n);
+        k.negate(a.data(), n1.data(), n);
+        EXPECT_EQ(n0, n1);
+
+        std::vector<std::int8_t> c0(n), c1(n);
+        ref.cmp(a.data(), b.data(), c0.data(), n);
+        k.cmp(a.data(), b.data(), c1.data(), n);
+        EXPECT_EQ(c0, c1);
+        k.cmp(a.data(), a.data(), c1.data(), n);
+        EXPECT_TRUE(std::all_of(c1.begin(), c1.end(), [](std::int8_t c) { return c == 0; }));
+    }
+
+    std::vector<std::uint64_t> mask(4);
+    std::vector<int128> out(n);
+    const std::size_t flagged = usub::umath::kernels::add<38>(a, b, out, mask);
+    std::size_t expect = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const bool ovf = (mask[i / 64] >> (i % 64)) & 1;
+        const bool fits = usub::umath::detail::fits_precision<38>(out[i]) &&
+                          ((a[i] < int128{0}) != (b[i] < int128{0}) || (out[i] < int128{0}) == (a[i] < int128{0}));
+        EXPECT_EQ(ovf, !fits) << i;
+        expect += !fits;
+    }
+    EXPECT_EQ(flagged, expect);
+    EXPECT_GT(flagged, 0u);
+
+    std::vector<std::int8_t> c(n);
+    usub::umath::kernels::cmp(a, b, c);
+    for (std::size_t i = 0; i < n; ++i) EXPECT_EQ(c[i], (a[i] > b[i]) - (a[i] < b[i]));
+    EXPECT_LT(int128{-1}, int128{1});
+}
+
+TEST(Aggregate, SumAvgWidenInsteadOfOverflowing) {
+    using N = Numeric128<38, 2>;
+    const std::string max = std::string(36, '9') + ".99";
+
+    std::vector<N> xs(1000, N(max));
+    xs.push_back(N("-1.01"));
+
+    const auto total = usub::umath::sum(xs);
+    static_assert(std::is_same_v<std::remove_const_t<decltype(total)>, Numeric256<76, 2>>);
+    ASSERT_TRUE(total.ok());
+
+    Numeric ref("-1.01");
+    for (int i = 0; i < 1000; ++i) ref += Numeric(max);
+    EXPECT_EQ(Numeric(total.to_string()), ref);
+
+    EXPECT_EQ(usub::umath::sum_checked(xs).error(), Err::Overflow);
+
+    const auto mean = usub::umath::avg(xs);
+    ASSERT_TRUE(mean.ok());
+    EXPECT_EQ(Numeric(mean.to_string()), Numeric::div(ref, Numeric(std::int64_t{1001}), 2, Rounding::HalfUp));
+}
+
+TEST(Aggregate, MatchesScalarReference) {
+    using N = Numeric128<18, 3>;
+    using C = Numeric128Column<18, 3>;
+    std::mt19937_64 rng(99);
+
+    for (std::size_t n: {std::size_t{0}, std::size_t{1}, std::size_t{2}, std::size_t{7}, std::size_t{1000}}) {
+        std::vector<N> xs;
+        i128w ref = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            const i128w v = static_cast<i128w>(rng() % 2000000000000000000ULL) - 1000000000000000000LL;
+            xs.push_back(N(to_fixed_string_i128(v / 10, 3)));
+            ref += v / 10;
+        }
+        const C col{std::span<const N>(xs)};
+
+        EXPECT_EQ(usub::umath::sum(xs).to_string(), to_fixed_string_i128(ref, 3));
+        EXPECT_EQ(usub::umath::sum(col).to_string(), to_fixed_string_i128(ref, 3));
+
+        const auto checked = usub::umath::sum_checked(std::span<const N>(xs));
+        if (iabs(ref) < pow10_i128(18)) {
+            ASSERT_TRUE(checked.has_value());
+            EXPECT_EQ(checked->to_string(), to_fixed_string_i128(ref, 3));
+        } else {
+            EXPECT_EQ(checked.error(), Err::Overflow);
+        }
+        EXPECT_EQ(usub::umath::sum_checked(col).has_value(), checked.has_value());
+
+        if (n == 0) {
+            EXPECT_EQ(usub::umath::avg(xs).error(), Err::DivByZero);
+            continue;
+        }
+        const i128w den = static_cast<i128w>(n);
+        i128w q = ref / den;
+        if (iabs(ref % den) * 2 >= den) q += ref < 0 ? -1 : 1;
+        EXPECT_EQ(usub::umath::avg(xs).to_string(), to_fixed_string_i128(q, 3));
+        EXPECT_EQ(usub::umath::avg(col).to_string(), to_fixed_string_i128(q, 3));
+        EXPECT_EQ(usub::umath::avg(xs, Rounding::Trunc).to_string(), to_fixed_string_i128(ref / den, 3));
+    }
+
+    std::vector<N> with_err = {N("1"), N("2"), N("oops"), N("3")};
+    EXPECT_EQ(usub::umath::sum(with_err).error(), Err::Invalid);
+    EXPECT_EQ(usub::umath::sum_checked(with_err).error(), Err::Invalid);
+    EXPECT_EQ(usub::umath::avg(C{std::span<const N>(with_err)}).error(), Err::Invalid);
+}
+
+static std::string mul_digits_ref(const std::string &a, const std::string &b) {
+    std::vector<std::uint32_t> acc(a.size() + b.size(), 0);
+    for (std::size_t i = a.size(); i-- > 0;) {
+        for (std::size_t j = b.size(); j-- > 0;) {
+            acc[i + j + 1] += static_cast<std::uint32_t>((a[i] - '0') * (b[j] - '0'));
+        }
+        for (std::size_t k = acc.size(); k-- > 1;) {
+            acc[k - 1] += acc[k] / 10;
+            acc[k] %= 10;
+        }
+    }
+    std::string r;
+    for (std::uint32_t d: acc) if (!r.empty() || d != 0) r.push_back(static_cast<char>('0' + d));
+    return r.empty() ? "0" : r;
+}
+
+TEST(Numeric, LargeMultiplyMatchesSchoolbook) {
+    std::mt19937_64 rng(31337);
+    auto digits = [&](std::size_t n, int mode) {
+        std::string s(n, '0');
+        for (auto &c: s) c = static_cast<char>('0' + (mode == 0 ? rng() % 10 : 9));
+        s[0] = static_cast<char>('1' + rng() % 9);
+        if (mode == 1) s[0] = '9';
+        return s;
+    };
+
+    const std::pair<std::size_t, std::size_t> sizes[] = {
+        {20, 30}, {300, 350}, {360, 400}, {700, 700}, {2200, 2200}, {2300, 2250}, {2200, 400}, {4000, 3000},
+        {5000, 370}, {3000, 2500},
+    };
+    for (const auto &[na, nb]: sizes) {
+        for (int mode = 0; mode < 2; ++mode) {
+            const std::string a = digits(na, mode);
+            const std::string b = digits(nb, mode);
+            const Numeric x(a), y(b);
+            const Numeric p = Numeric::mul(x, y, 0, Rounding::Trunc);
+            ASSERT_TRUE(p.ok());
+            EXPECT_EQ(p.to_string(), mul_digits_ref(a, b)) << na << "x" << nb << " mode " << mode;
+        }
+    }
+}
+
+TEST(Numeric, NttMultiplyMatchesMulAbs) {
+    std::mt19937_64 rng(4242);
+    auto limbs = [&](std::size_t n, bool nines) {
+        std::vector<std::uint32_t> v(n);
+        for (auto &x: v) x = nines ? 999999999U : static_cast<std::uint32_t>(rng() % 1000000000U);
+        v.back() = std::max<std::uint32_t>(v.back(), 1U);
+        return v;
+    };
+    auto to_numeric = [](const std::vector<std::uint32_t> &v) {
+        std::string s = std::to_string(v.back());
+        for (std::size_t i = v.size() - 1; i-- > 0;) {
+            const std::string part = std::to_string(v[i]);
+            s += std::string(9 - part.size(), '0') + part;
+        }
+        return Numeric(s);
+    };
+
+    for (const auto &[na, nb]: {std::pair<std::size_t, std::size_t>{1, 1}, {5, 8}, {7, 63}, {13, 1201}, {3, 700},
+                                 {64, 64}, {250, 260}, {900, 999}}) {
+        for (bool nines: {false, true}) {
+            const auto a = limbs(na, nines);
+            const auto b = limbs(nb, nines);
+            auto r = usub::umath::detail::mul_ntt_base1e9(a.data(), a.size(), b.data(), b.size());
+            while (!r.empty() && r.back() == 0U) r.pop_back();
+            EXPECT_EQ(to_numeric(r), Numeric::mul(to_numeric(a), to_numeric(b), 0, Rounding::Trunc))
+                << na << "x" << nb;
+        }
+    }
+
+    std::string a(9500, '0'), b(9100, '0');
+    for (auto &c: a) c = static_cast<char>('0' + rng() % 10);
+    for (auto &c: b) c = static_cast<char>('0' + rng() % 10);
+    a[0] = b[0] = '8';
+    EXPECT_EQ(Numeric::mul(Numeric(a), Numeric(b), 0, Rounding::Trunc).to_string(), mul_digits_ref(a, b));
+}
+
+TEST(Numeric, LargeDivisionSatisfiesRemainderIdentity) {
+    std::mt19937_64 rng(8080);
+    auto digits = [&](std::size_t n, int mode) {
+        std::string s(n, '9');
+        if (mode == 0) for (auto &c: s) c = static_cast<char>('0' + rng() % 10);
+        if (mode == 2) std::fill(s.begin() + 1, s.end(), '0');
+        s[0] = mode == 2 ? '1' : static_cast<char>('1' + rng() % 9);
+        return s;
+    };
+
+    const std::pair<std::size_t, std::size_t> sizes[] = {
+        {30, 12}, {200, 100}, {2000, 19}, {3000, 1500}, {5400, 2700}, {8000, 2600}, {8000, 5000}, {12000, 3000},
+    };
+    for (const auto &[na, nb]: sizes) {
+        for (int mode = 0; mode < 3; ++mode) {
+            const Numeric a(digits(na, mode));
+            const Numeric b(digits(nb, (mode + 1) % 3));
+            const Numeric q = Numeric::div(a, b, 0, Rounding::Trunc);
+            ASSERT_TRUE(q.ok());
+            const Numeric r = a - Numeric::mul(q, b, 0, Rounding::Trunc);
+            EXPECT_FALSE(r.negative()) << na << "/" << nb << " mode " << mode;
+            const Numeric gap = b - r;
+            EXPECT_TRUE(!gap.negative() && gap != Numeric(std::int64_t{0})) << na << "/" << nb << " mode " << mode;
+
+            const Numeric exact = Numeric::mul(a, b, 0, Rounding::Trunc);
+            EXPECT_EQ(Numeric::div(exact, b, 0, Rounding::Trunc), a) << na << "/" << nb << " mode " << mode;
+        }
+    }
+}
+
+TEST(Numeric, SmallLimbsSpillKeepsContents) {
+    using limbs = usub::umath::detail::small_limbs<4>;
+    limbs a{1U, 2U, 3U};
+    EXPECT_EQ(a.capacity(), 4U);
+    for (std::uint32_t i = 4; i <= 20; ++i) a.push_back(i);
+    EXPECT_GE(a.capacity(), 20U);
+    for (std::uint32_t i = 0; i < 20; ++i) EXPECT_EQ(a[i], i + 1U);
+
+    limbs b = a;
+    limbs c = std::move(a);
+    EXPECT_TRUE(a.empty());
+    EXPECT_EQ(b, c);
+
+    const std::uint32_t front[] = {7U, 8U};
+    c.erase(c.begin(), c.begin() + 18);
+    c.insert(c.begin(), std::begin(front), std::end(front));
+    EXPECT_EQ(c, (limbs{7U, 8U, 19U, 20U}));
+
+    limbs d{5U};
+    d.swap(b);
+    EXPECT_EQ(b, limbs{5U});
+    EXPECT_EQ(d.size(), 20U);
+
+    // Values either side of the inline capacity behave the same.
+    const Numeric x("999999999999999999999999999999999999999999999999999999");
+    const Numeric one(std::int64_t{1});
+    EXPECT_EQ((x + one).to_string(), "1" + std::string(54, '0'));
+    EXPECT_EQ((x + one - one), x);
+    EXPECT_EQ((x * x / x).to_string(), x.to_string());
+}
+
+namespace {
+    class counting_resource final : public std::pmr::memory_resource {
+    public:
+        std::size_t allocations = 0;
+
+    private:
+        void *do_allocate(std::size_t bytes, std::size_t align) override {
+            ++allocations;
+            return std::pmr::new_delete_resource()->allocate(bytes, align);
+        }
+
+        void do_deallocate(void *p, std::size_t bytes, std::size_t align) override {
+            std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+        }
+
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &o) const noexcept override {
+            return this == &o;
+        }
+    };
+}
+
+TEST(Numeric, ArithmeticDrawsFromOperandResource) {
+    counting_resource fallback, arena;
+    std::pmr::memory_resource *old = std::pmr::set_default_resource(&fallback);
+
+    std::mt19937_64 rng(15);
+    auto digits = [&](std::size_t n) {
+        std::string s(n, '0');
+        for (auto &c: s) c = static_cast<char>('0' + rng() % 10);
+        s[0] = '7';
+        return s;
+    };
+
+    for (const std::size_t n: {30, 120, 900, 4000, 12000, 20000}) {
+        const std::string sa = digits(n), sb = digits(n / 2 + 1);
+        const Numeric a(sa + ".25", &arena);
+        const Numeric b(sb, &arena);
+        EXPECT_EQ(a.resource(), &arena);
+
+        Numeric acc(std::int64_t{0}, &arena);
+        acc += a;
+        acc -= b;
+        const Numeric p = Numeric::mul(a, b, 2, Rounding::HalfUp);
+        const Numeric q = Numeric::div(p, b, 2, Rounding::HalfUp);
+        EXPECT_EQ(p.resource(), &arena);
+        EXPECT_EQ(q, a) << n;
+
+        std::pmr::set_default_resource(old);
+        EXPECT_EQ(acc, Numeric(sa + ".25") - Numeric(sb)) << n;
+        std::pmr::set_default_resource(&fallback);
+    }
+
+    std::pmr::set_default_resource(old);
+    EXPECT_EQ(fallback.allocations, 0U);
+    EXPECT_GT(arena.allocations, 0U);
+
+    // Moves never throw, so std::vector<Numeric> relocates by moving; a move across resources copies.
+    static_assert(std::is_nothrow_move_constructible_v<Numeric> && std::is_nothrow_move_assignable_v<Numeric> &&
+                  std::is_nothrow_swappable_v<Numeric>);
+    const std::string big = digits(200);
+    Numeric in_arena(std::int64_t{0}, &arena), elsewhere(big, &fallback);
+    in_arena = std::move(elsewhere);
+    EXPECT_EQ(in_arena.resource(), &arena);
+    EXPECT_EQ(in_arena.to_string(), big);
+    Numeric other(digits(300), &fallback);
+    const std::string other_s = other.to_string();
+    std::swap(in_arena, other);
+    EXPECT_EQ(in_arena.to_string(), other_s);
+    EXPECT_EQ(other.to_string(), big);
+}
+
+TEST(Numeric, InPlaceAssignMatchesBinaryOps) {
+    const char *vals[] = {
+        "0", "1", "-1", "0.5", "-0.125", "999999999", "-1000000000.000000001",
+        "123456789012345678901234567890.123456789", "-98765432109876543210987654321098765432109876543210.5",
+    };
+    for (const char *sa: vals) {
+        for (const char *sb: vals) {
+            const Numeric a(sa), b(sb);
+            Numeric x = a;
+            EXPECT_EQ(x.add_assign(b), a + b) << sa << " + " << sb;
+            EXPECT_EQ(x.scale(), (a + b).scale());
+            x = a;
+            EXPECT_EQ(x.sub_assign(b), a - b) << sa << " - " << sb;
+            x = a;
+            EXPECT_EQ(x.mul_assign(b, 3, Rounding::HalfUp), Numeric::mul(a, b, 3, Rounding::HalfUp))
+                << sa << " * " << sb;
+            x = a;
+            x *= b;
+            EXPECT_EQ(x, a * b) << sa << " * " << sb;
+        }
+    }
+
+    Numeric self_ref("-12.5");
+    self_ref += self_ref;
+    EXPECT_EQ(self_ref.to_string(), "-25.0");
+    self_ref -= self_ref;
+    EXPECT_EQ(self_ref.to_string(), "0");
+    Numeric sq("1000000000000000000.5");
+    sq.mul_assign(sq, 2, Rounding::Trunc);
+    EXPECT_EQ(sq.to_string(), "1000000000000000001000000000000000000.25");
+
+    Numeric bad("x");
+    Numeric y("1");
+    y += bad;
+    EXPECT_EQ(y.error(), Err::Invalid);
+}
+
+TEST(Numeric, InPlaceAccumulatorReusesLimbs) {
+    counting_resource arena;
+    Numeric acc(std::string(120, '7') + ".5", &arena);
+    const Numeric step("1234.56789");
+    const Numeric neg_step("-0.00001");
+
+    acc += step;
+    const std::size_t warm = arena.allocations;
+    for (int i = 0; i < 1000; ++i) {
+        acc += step;
+        acc -= neg_step;
+    }
+    EXPECT_EQ(arena.allocations, warm);
+    EXPECT_EQ(acc, Numeric(std::string(120, '7') + ".5") + Numeric("1235802.45789") + Numeric("0.01"));
+}
+
+TEST(Numeric128, FmaRoundsOnce) {
+    using N = Numeric128<18, 2>;
+    EXPECT_EQ(N::fma(N("1.25"), N("1.25"), N("0.01"), Rounding::HalfUp).to_string(), "1.57");
+    EXPECT_EQ(N::fma(N("-1.25"), N("1.25"), N("0"), Rounding::HalfUp).to_string(), "-1.56");
+    EXPECT_EQ(N::fma(N("-1.25"), N("1.25"), N("0"), Rounding::Trunc).to_string(), "-1.56");
+    EXPECT_EQ(N::fma(N("0.05"), N("0.05"), N("-0.01"), Rounding::Trunc).to_string(), "0.00");
+    EXPECT_EQ(N::fma(N("0.05"), N("0.05"), N("-0.01"), Rounding::HalfUp).to_string(), "-0.01");
+
+    // The 256-bit product accepts operands whose raw product would not fit in 128 bits.
+    using W = Numeric128<38, 10>;
+    const W big("10000000000000");
+    EXPECT_EQ(W::mul(big, big, Rounding::HalfUp).error(), Err::Overflow);
+    const W r = W::fma(big, big, W("-0.5"), Rounding::HalfUp);
+    ASSERT_TRUE(r.ok());
+    EXPECT_EQ(r.to_string(), "99999999999999999999999999.5000000000");
+
+    EXPECT_EQ(W::fma(big, big, big, Rounding::HalfUp).ok(), true);
+    EXPECT_EQ(W::fma(big * W("100"), big, W("0"), Rounding::HalfUp).error(), Err::Overflow);
+    EXPECT_EQ(W::fma(big, W("x"), big, Rounding::HalfUp).error(), Err::Invalid);
+}
+
+TEST(Numeric128, ExpressionEvaluatesExactly) {
+    using usub::umath::expr;
+    using N = Numeric128<18, 2>;
+    const N price("0.05"), qty("0.05"), fee("1.00"), hundred("100");
+
+    EXPECT_EQ((price * qty * hundred).to_string(), "0.00");
+    const N once = expr(price) * qty * hundred;
+    EXPECT_EQ(once.to_string(), "0.25");
+
+    const N total = (expr(price) * qty + fee).eval<18, 2>(Rounding::Trunc);
+    EXPECT_EQ(total.to_string(), "1.00");
+    const N net = fee - expr(price) * hundred;
+    EXPECT_EQ(net.to_string(), "-4.00");
+
+    // Leaves of different types are aligned exactly; the target type decides the final scale.
+    const Numeric128<10, 4> rate("1.0825");
+    const Numeric128<20, 6> converted = expr(N("19.99")) * rate;
+    EXPECT_EQ(converted.to_string(), "21.639175");
+    const auto rounded = (expr(N("19.99")) * rate).eval<18, 2>(Rounding::HalfUp);
+    EXPECT_EQ(rounded.to_string(), "21.64");
+    const N diff = (expr(rate) - N("1.5")) * hundred;
+    EXPECT_EQ(diff.to_string(), "-41.75");
+
+    const N bad("x");
+    const N invalid = expr(price) * bad + fee;
+    EXPECT_EQ(invalid.error(), Err::Invalid);
+    // With several bad inputs the leftmost error wins, for products and sums alike.
+    const N too_big("12345678901234567890");
+    ASSERT_EQ(too_big.error(), Err::Overflow);
+    EXPECT_EQ(N(expr(bad) * too_big).error(), Err::Invalid);
+    EXPECT_EQ(N(expr(too_big) * bad).error(), Err::Overflow);
+    EXPECT_EQ(N(expr(bad) + too_big).error(), Err::Invalid);
+    EXPECT_EQ(N(expr(too_big) - bad).error(), Err::Overflow);
+    const N max("9999999999999999.99");
+    const N overflow = expr(max) * max;
+    EXPECT_EQ(overflow.error(), Err::Overflow);
+    const Numeric128<38, 4> square = expr(max) * max;
+    EXPECT_EQ(square.to_string(), "99999999999999999800000000000000.0001");
+}
+
+TEST(Aggregate, DotRoundsOnceAndMatchesNumeric) {
+    using N = Numeric128<38, 4>;
+    std::mt19937_64 rng(18);
+    auto random_value = [&](int int_digits) {
+        std::string s = rng() % 2 ? "-" : "";
+        for (int i = 0; i < int_digits; ++i) s += static_cast<char>('0' + rng() % 10);
+        s += '.';
+        for (int i = 0; i < 4; ++i) s += static_cast<char>('0' + rng() % 10);
+        return s;
+    };
+
+    for (const int digits: {3, 17, 34}) {
+        std::vector<N> a, b;
+        Numeric exact(std::int64_t{0});
+        for (int i = 0; i < 300; ++i) {
+            const std::string sa = random_value(digits), sb = random_value(digits);
+            a.emplace_back(sa);
+            b.emplace_back(sb);
+            exact += Numeric::mul(Numeric(sa), Numeric(sb), 8, Rounding::Trunc);
+        }
+        for (const Rounding rnd: {Rounding::Trunc, Rounding::HalfUp}) {
+            const auto d = usub::umath::dot(a, b, rnd);
+            static_assert(std::is_same_v<std::remove_const_t<decltype(d)>, Numeric256<76, 4>>);
+            ASSERT_TRUE(d.ok()) << digits;
+            Numeric want = exact;
+            want.rescale(4, rnd);
+            EXPECT_EQ(Numeric(d.to_string()), want) << digits;
+        }
+    }
+
+    // One rounding at the end, not one per product.
+    const std::vector<Numeric128<18, 2>> qty(10, Numeric128<18, 2>("0.05"));
+    const std::vector<Numeric128<18, 2>> px(10, Numeric128<18, 2>("0.05"));
+    EXPECT_EQ(usub::umath::dot(qty, px).to_string(), "0.03");
+    EXPECT_EQ(usub::umath::dot(qty, px, Rounding::Trunc).to_string(), "0.02");
+
+    std::vector<N> bad(3, N("1")), ones(3, N("1"));
+    bad[2] = N("x");
+    EXPECT_EQ(usub::umath::dot(ones, bad).error(), Err::Invalid);
+    EXPECT_EQ(usub::umath::dot(ones, std::vector<N>{}).to_string(), "0.0000");
+}
+
+TEST(Aggregate, DotChunksMatchSerial) {
+    using N = Numeric128<38, 2>;
+    const N big(std::string(36, '9') + ".99");
+    std::vector<N> a(100000), b(100000);
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        a[i] = i % 2 ? big : -big;
+        b[i] = i % 7 ? big : N(static_cast<std::int64_t>(i));
+    }
+    const auto serial = usub::umath::dot(a, b);
+    ASSERT_TRUE(serial.ok());
+    for (const std::size_t chunks: {2, 4, 7}) {
+        EXPECT_EQ(usub::umath::dot(a, b, Rounding::HalfUp, chunks), serial) << chunks;
+    }
+
+    std::vector<N> all_big(100000, big);
+    EXPECT_EQ(usub::umath::dot(all_big, all_big, Rounding::HalfUp, 4).error(), Err::Overflow);
+}
+
+TEST(Numeric128, MixedTypeArithmetic) {
+    using Price = Numeric128<18, 2>;
+    using Rate = Numeric128<38, 8>;
+    using Qty = Numeric128<10, 4>;
+
+    static_assert(std::is_same_v<usub::umath::numeric128_add_t<Price, Qty>, Numeric128<21, 4>>);
+    static_assert(std::is_same_v<usub::umath::numeric128_mul_t<Price, Qty>, Numeric128<28, 6>>);
+    static_assert(std::is_same_v<usub::umath::numeric128_div_t<Price, Qty>, Numeric128<33, 13>>);
+    static_assert(std::is_same_v<usub::umath::numeric128_add_t<Price, Rate>, Numeric128<38, 7>>);
+    static_assert(std::is_same_v<usub::umath::numeric128_mul_t<Price, Rate>, Numeric128<38, 6>>);
+
+    const Price amount("19.99");
+    const Rate fx("1.08253456");
+    const Qty qty("3.1415");
+
+    const auto sum = amount + qty;
+    static_assert(std::is_same_v<std::remove_const_t<decltype(sum)>, Numeric128<21, 4>>);
+    EXPECT_EQ(sum.to_string(), "23.1315");
+    EXPECT_EQ((qty - amount).to_string(), "-16.8485");
+    EXPECT_EQ((amount * qty).to_string(), "62.798585");
+
+    // 19.99 * 1.08253456 = 21.6398658544, rounded to the 6-digit product scale.
+    EXPECT_EQ((amount * fx).to_string(), "21.639866");
+    EXPECT_EQ(usub::umath::mul(amount, fx, Rounding::Trunc).to_string(), "21.639865");
+    EXPECT_EQ((amount / qty).to_string(), "6.3632022918988");
+    EXPECT_EQ(usub::umath::div(-amount, qty, Rounding::Trunc).to_string(), "-6.3632022918987");
+    EXPECT_EQ((amount / fx).to_string(), "18.46592315722465");
+    EXPECT_EQ((amount / Qty("0")).error(), Err::DivByZero);
+    EXPECT_EQ((Price("x") + qty).error(), Err::Invalid);
+
+    const Rate big("999999999999999999999999999999.99999999");
+    EXPECT_EQ((big + amount).to_string(), "1000000000000000000000000000019.9900000");
+    EXPECT_EQ((big + big).error(), Err::Overflow);
+    EXPECT_EQ((big * Numeric128<5, 4>("0.0001")).to_string(), "100000000000000000000000000.0000000");
+
+    const Numeric128<38, 0> huge("99999999999999999999999999999999999999");
+    EXPECT_EQ((huge / Numeric128<5, 4>("0.5000")).error(), Err::Overflow);
+    EXPECT_EQ((Numeric128<38, 30>("1.5") / Numeric128<38, 0>("3")).to_string(), "0.500000000000000000000000000000");
+    EXPECT_EQ((Numeric128<38, 0>("7") / Numeric128<38, 38>("0.03")).to_string(), "233.333333");
+}
+
+TEST(Numeric, ConvertsBetweenDecimalTypes) {
+    using usub::umath::numeric_cast;
+    using N128 = Numeric128<38, 6>;
+    using N256 = Numeric256<76, 10>;
+
+    const N128 a("-12345678901234567890123456789.123456");
+    const Numeric na = numeric_cast<Numeric>(a);
+    EXPECT_EQ(na.scale(), 6);
+    EXPECT_EQ(na.to_string(), Numeric("-12345678901234567890123456789.123456").to_string());
+    EXPECT_EQ(numeric_cast<N128>(na).raw(), a.raw());
+
+    const N256 w = numeric_cast<N256>(a);
+    EXPECT_EQ(w.to_string(), "-12345678901234567890123456789.1234560000");
+    EXPECT_EQ(numeric_cast<N128>(w).raw(), a.raw());
+
+    const N256 wide("123456789012345678901234567890123456789012345678901234567890.0123456789");
+    const Numeric nw = numeric_cast<Numeric>(wide);
+    EXPECT_EQ(nw.to_string(), Numeric("123456789012345678901234567890123456789012345678901234567890.0123456789").to_string());
+    EXPECT_EQ(numeric_cast<N256>(nw).raw(), wide.raw());
+    EXPECT_EQ(numeric_cast<N128>(wide).error(), Err::Overflow);
+
+    // Scale changes round once; widening that runs out of precision overflows.
+    using D6 = Numeric128<18, 6>;
+    using D2 = Numeric128<10, 2>;
+    using D4 = Numeric128<18, 4>;
+    using Int = Numeric128<38, 0>;
+    using Frac = Numeric256<40, 38>;
+    using Small = Numeric128<5, 2>;
+    const Numeric x("2.3456785");
+    EXPECT_EQ(numeric_cast<D6>(x).to_string(), "2.345679");
+    EXPECT_EQ(numeric_cast<D6>(x, Rounding::Trunc).to_string(), "2.345678");
+    EXPECT_EQ(numeric_cast<D6>(Numeric("-2.3456785")).to_string(), "-2.345679");
+    EXPECT_EQ(numeric_cast<D2>(D4("99999999.995")).error(), Err::Overflow);
+    EXPECT_EQ(numeric_cast<D2>(D4("99999999.994")).to_string(), "99999999.99");
+    EXPECT_EQ(numeric_cast<Frac>(Int("12")).to_string().size(), 41U);
+    EXPECT_EQ(numeric_cast<Frac>(Int("123")).error(), Err::Overflow);
+    EXPECT_EQ(numeric_cast<Small>(Numeric("1000")).error(), Err::Overflow);
+    EXPECT_EQ(numeric_cast<Small>(Numeric("0.004")).to_string(), "0.00");
+    EXPECT_EQ(numeric_cast<Numeric>(Small("0")).to_string(), Numeric("0").to_string());
+
+    EXPECT_EQ(numeric_cast<Numeric>(N128("abc")).error(), Err::Invalid);
+    EXPECT_EQ(numeric_cast<N256>(Numeric("abc")).error(), Err::Invalid);
+}
+
+TEST(Numeric, ParallelMulDivMatchSerial) {
+    std::mt19937_64 rng(2121);
+    auto digits = [&](std::size_t n) {
+        std::string s(n, '0');
+        for (auto &c: s) c = static_cast<char>('0' + rng() % 10);
+        s[0] = static_cast<char>('1' + rng() % 9);
+        return s;
+    };
+
+    // NTT-sized operands, an unbalanced product split into slices, and a Newton division.
+    const Numeric a(digits(100000));
+    const Numeric b("-" + digits(30000));
+    const Numeric c(digits(4000));
+    const Numeric ab = Numeric::mul(a, b, 0, Rounding::Trunc);
+    const Numeric ac = Numeric::mul(a, c, 0, Rounding::Trunc);
+    const Numeric q = Numeric::div(a, b, 3, Rounding::HalfUp);
+    ASSERT_TRUE(ab.ok() && ac.ok() && q.ok());
+    for (const unsigned threads: {2U, 3U, 8U}) {
+        EXPECT_EQ(Numeric::mul(a, b, 0, Rounding::Trunc, threads), ab);
+        EXPECT_EQ(Numeric::mul(a, c, 0, Rounding::Trunc, threads), ac);
+        EXPECT_EQ(Numeric::div(a, b, 3, Rounding::HalfUp, threads), q);
+    }
+
+    // Worker scratch goes to the caller's thread-safe resource; the result stays on the operand's.
+    struct shared_counting final : std::pmr::memory_resource {
+        std::atomic<std::size_t> allocations{0};
+
+        void *do_allocate(std::size_t bytes, std::size_t align) override {
+            allocations.fetch_add(1, std::memory_order_relaxed);
+            return std::pmr::new_delete_resource()->allocate(bytes, align);
+        }
+
+        void do_deallocate(void *p, std::size_t bytes, std::size_t align) override {
+            std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+        }
+
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &o) const noexcept override {
+            return this == &o;
+        }
+    } workers;
+    std::pmr::synchronized_pool_resource pool(&workers);
+    const Numeric p = Numeric::mul(a, b, 0, Rounding::Trunc, 4, &pool);
+    EXPECT_EQ(p, ab);
+    EXPECT_EQ(p.resource(), a.resource());
+    EXPECT_EQ(Numeric::div(a, b, 3, Rounding::HalfUp, 4, &pool), q);
+    EXPECT_GT(workers.allocations.load(), 0U);
+}
+
+TEST(Numeric, ThreadPoolRunsNestedBlocks) {
+    // A private pool, so the workers exist even where hardware_concurrency() is 1.
+    usub::umath::detail::thread_pool pool(3);
+    EXPECT_EQ(pool.size(), 3U);
+
+    struct ctx {
+        usub::umath::detail::thread_pool *pool;
+        std::atomic<std::size_t> *hits;
+    };
+    std::atomic<std::size_t> hits{0};
+    ctx c{&pool, &hits};
+    for (int round = 0; round < 50; ++round) {
+        pool.run(6, [](void *p, std::size_t) {
+            auto &outer = *static_cast<ctx *>(p);
+            outer.pool->run(5, [](void *q, std::size_t) {
+                static_cast<ctx *>(q)->hits->fetch_add(1, std::memory_order_relaxed);
+            }, p);
+        }, &c);
+    }
+    EXPECT_EQ(hits.load(), 50U * 6U * 5U);
+}
+
+TEST(Aggregate, PolicyReductionsMatchSerial) {
+    namespace ex = usub::umath::execution;
+    using N = Numeric128<38, 2>;
+    using W = Numeric256<76, 3>;
+
+    std::mt19937_64 rng(2323);
+    std::vector<N> xs(200003);
+    std::vector<W> ws(xs.size());
+    for (std::size_t i = 0; i < xs.size(); ++i) {
+        const auto v = static_cast<std::int64_t>(rng() % 2000000001U) - 1000000000;
+        xs[i] = N(v) / N(std::int64_t{7});
+        ws[i] = W(std::to_string(v) + "123456789012345678901234567890.125");
+    }
+    xs[123456] = N(std::string(36, '9') + ".99");
+
+    const auto total = usub::umath::sum(xs);
+    EXPECT_EQ(usub::umath::sum(ex::seq, xs), total);
+    const auto wtotal = usub::umath::sum(ex::seq, ws);
+    ASSERT_TRUE(wtotal.ok());
+    const auto square = [](const N &x) {
+        const auto w = usub::umath::numeric_cast<Numeric256<76, 2>>(x);
+        return w * w;
+    };
+    const auto sq = usub::umath::transform_reduce(ex::seq, xs, square);
+    ASSERT_TRUE(sq.ok());
+    EXPECT_EQ(usub::umath::max(xs), xs[123456]);
+    EXPECT_EQ(usub::umath::min(ws), *std::ranges::min_element(ws));
+
+    for (const unsigned threads: {2U, 5U, 12U}) {
+        EXPECT_EQ(usub::umath::sum(ex::par(threads), xs), total) << threads;
+        EXPECT_EQ(usub::umath::reduce(ex::par_unseq(threads), xs), total) << threads;
+        EXPECT_EQ(usub::umath::sum(ex::par(threads), ws), wtotal) << threads;
+        EXPECT_EQ(usub::umath::transform_reduce(ex::par(threads), xs, square), sq);
+        EXPECT_EQ(usub::umath::transform_reduce(ex::par(threads), xs, xs), usub::umath::dot(xs, xs));
+        EXPECT_EQ(usub::umath::min(ex::par(threads), xs), usub::umath::min(xs));
+        EXPECT_EQ(usub::umath::max(ex::par(threads), ws), usub::umath::max(ws));
+    }
+
+    std::vector<W> huge(16, W(std::string(73, '9') + ".999"));
+    EXPECT_EQ(usub::umath::sum(ex::par, huge).error(), Err::Overflow);
+    EXPECT_EQ(usub::umath::min(ex::par, std::vector<N>{}).error(), Err::Invalid);
+    xs[150000] = N("x");
+    EXPECT_EQ(usub::umath::max(ex::par(4), xs).error(), Err::Invalid);
+    EXPECT_EQ(usub::umath::sum(ex::par(4), xs).error(), Err::Invalid);
+}
+
+TEST(Numeric, AccumulatorMatchesSerialSum) {
+    using usub::umath::NumericAccumulator;
+    std::mt19937_64 rng(2424);
+    std::vector<Numeric> xs;
+    for (int i = 0; i < 3000; ++i) {
+        std::string s = rng() % 2 ? "-" : "";
+        s += std::to_string(rng() % 1000000000000ULL);
+        const int frac = static_cast<int>(rng() % 25);
+        if (frac > 0) {
+            s += '.';
+            for (int k = 0; k < frac; ++k) s += static_cast<char>('0' + rng() % 10);
+        }
+        if (i % 500 == 7) s = std::string(60, '9') + ".5";
+        xs.emplace_back(s);
+    }
+
+    Numeric serial(std::int64_t{0});
+    for (const auto &x: xs) serial += x;
+    ASSERT_TRUE(serial.ok());
+
+    NumericAccumulator acc;
+    for (const auto &x: xs) acc += x;
+    EXPECT_EQ(acc.result(), serial);
+    EXPECT_EQ(acc.result().to_string(), serial.to_string());
+
+    // Any order and any split into merged partial accumulators give the same total.
+    std::vector<Numeric> shuffled = xs;
+    std::shuffle(shuffled.begin(), shuffled.end(), rng);
+    NumericAccumulator a, b, c;
+    for (std::size_t i = 0; i < shuffled.size(); ++i) (i % 3 == 0 ? a : i % 3 == 1 ? b : c).add(shuffled[i]);
+    c.merge(a).merge(b);
+    EXPECT_EQ(c.result(), serial);
+
+    for (const auto &x: xs) acc.sub(x);
+    EXPECT_EQ(acc.result(), Numeric(std::int64_t{0}));
+    acc.sub(Numeric("0.001"));
+    EXPECT_TRUE(acc.result().negative());
+    EXPECT_EQ(acc.result() + Numeric("0.001"), Numeric(std::int64_t{0}));
+
+    namespace ex = usub::umath::execution;
+    std::vector<Numeric> many(40000, Numeric("-1.25"));
+    for (std::size_t i = 0; i < many.size(); i += 3) many[i] = Numeric("2.375");
+    const Numeric total = usub::umath::sum(many);
+    EXPECT_EQ(total.to_string(), "-1664.250");
+    for (const unsigned threads: {2U, 3U, 8U}) EXPECT_EQ(usub::umath::sum(ex::par(threads), many), total);
+    EXPECT_EQ(usub::umath::reduce(ex::par(4), xs), serial);
+
+    many[12345] = Numeric("bad");
+    EXPECT_EQ(usub::umath::sum(ex::par(4), many).error(), Err::Invalid);
+}
+
+TEST(GroupAggregate, MatchesReferenceAndMerges) {
+    using N = Numeric128<38, 2>;
+    using Table = usub::umath::GroupAggregate<38, 2>;
+
+    std::mt19937_64 rng(2525);
+    const std::size_t rows = 50000;
+    std::vector<std::uint64_t> keys(rows);
+    std::vector<N> values(rows);
+    for (std::size_t i = 0; i < rows; ++i) {
+        keys[i] = rng() % 3000 * 7919;
+        values[i] = N(static_cast<std::int64_t>(rng() % 2000001) - 1000000) / N(std::int64_t{100});
+    }
+    const N big(std::string(35, '9') + ".99");
+    for (std::size_t i = 0; i < rows; i += 97) {
+        keys[i] = 42;
+        values[i] = big;
+    }
+
+    struct ref_group {
+        std::uint64_t count = 0;
+        int256 sum{};
+        N min, max;
+    };
+    std::vector<std::pair<std::uint64_t, ref_group>> ref;
+    for (std::size_t i = 0; i < rows; ++i) {
+        auto it = std::find_if(ref.begin(), ref.end(), [&](const auto &g) { return g.first == keys[i]; });
+        if (it == ref.end()) {
+            ref.push_back({keys[i], {0, int256{0}, values[i], values[i]}});
+            it = ref.end() - 1;
+        }
+        it->second.count++;
+        it->second.sum += usub::umath::detail::widen_i256(values[i].raw());
+        it->second.min = std::min(it->second.min, values[i]);
+        it->second.max = std::max(it->second.max, values[i]);
+    }
+
+    Table batch;
+    batch.update(keys, values);
+    Table column;
+    column.update(keys, Numeric128Column<38, 2>(values));
+    Table a, b, c(4000);
+    for (std::size_t i = 0; i < rows; ++i) (i % 3 == 0 ? a : i % 3 == 1 ? b : c).update(keys[i], values[i]);
+    c.merge(a);
+    c.merge(b);
+
+    ASSERT_EQ(batch.size(), ref.size());
+    for (std::size_t g = 0; g < ref.size(); ++g) {
+        const auto &[key, r] = ref[g];
+        EXPECT_EQ(batch[g].key, key);
+        for (const Table *t: {&batch, &column, &c}) {
+            const auto found = t->find(key);
+            ASSERT_TRUE(found.has_value()) << key;
+            EXPECT_EQ(found->count, r.count);
+            EXPECT_EQ(found->sum.raw(), r.sum);
+            EXPECT_EQ(found->min, r.min);
+            EXPECT_EQ(found->max, r.max);
+        }
+    }
+    EXPECT_FALSE(batch.find(1).has_value());
+
+    // 516 rows near 10^35 (raw 10^37) overflow int128 but not the group's int256 sum.
+    EXPECT_EQ(batch.find(42)->sum.to_string().size(), 41U);
+
+    values[5] = N("x");
+    keys[5] = 99;
+    Table with_error;
+    with_error.update(keys, values);
+    EXPECT_EQ(with_error.find(99)->sum.error(), Err::Invalid);
+    EXPECT_EQ(with_error.find(99)->count, 1U);
+    EXPECT_TRUE(with_error.find(42)->sum.ok());
+
+    // Errors in both tables: the merged group reports the same error whichever table is merged first.
+    const N overflow(std::string(37, '9'));
+    ASSERT_EQ(overflow.error(), Err::Overflow);
+    Table left, right;
+    left.update(7, N(std::int64_t{1}));
+    left.update(7, overflow);
+    right.update(7, N("bad"));
+    right.update(7, N(std::int64_t{2}));
+    Table lr, rl;
+    lr.merge(left);
+    lr.merge(right);
+    rl.merge(right);
+    rl.merge(left);
+    EXPECT_EQ(lr.find(7)->sum.error(), Err::Invalid);
+    EXPECT_EQ(rl.find(7)->sum.error(), Err::Invalid);
+    EXPECT_EQ(lr.find(7)->min.error(), Err::Invalid);
+    EXPECT_EQ(lr.find(7)->count, 4U);
+    EXPECT_EQ(rl.find(7)->count, 4U);
+    Table by_row;
+    by_row.update(7, overflow);
+    by_row.update(7, N("bad"));
+    EXPECT_EQ(by_row.find(7)->sum.error(), Err::Invalid);
+}